@@ -0,0 +1,583 @@
+/*
+ * Objetivo: Exportar o conteúdo da BST do BST_TRIE.c (em ordem) para um
+ *           arquivo de dicionário ordenado e comprimido por prefixo
+ *           ("front coding"), que pode ser consultado direto do disco.
+ *
+ * Formato do arquivo:
+ *   [CabecalhoFC]
+ *   [blocos]  Cada bloco tem PALAVRAS_POR_BLOCO palavras (o último pode ter menos).
+ *             A 1ª palavra do bloco é guardada inteira: [tam][bytes].
+ *             As seguintes guardam só o que muda em relação à anterior:
+ *             [bytes em comum][tam do sufixo][sufixo].
+ *   [índice]  Um uint32_t por bloco: posição do bloco no arquivo.
+ *
+ * Como as palavras estão ordenadas, "casa, casamento, casar" vira
+ * "casa, (4)mento, (4)r". A busca faz busca binária no índice comparando
+ * com a 1ª palavra de cada bloco (que está inteira) e depois decodifica no
+ * máximo um bloco. Nada é descomprimido na carga: o arquivo é mapeado com
+ * mmap e usado como está.
+ *
+ * Tamanhos (bytes em comum, sufixo) ocupam 1 byte: palavras têm menos de 256 bytes.
+ *
+ * Uso: ./BST_Front_Coding [arquivo_de_palavras.txt] [saida.fc]
+ *      Sem saida.fc, o arquivo temporário dicionario_bst.fc é apagado no fim.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef _WIN32
+// No Windows (MSYS2/ucrt) não há mmap: o arquivo é lido inteiro para a memória.
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define PALAVRAS_POR_BLOCO 16 // Palavras por bloco: maior = arquivo menor, busca mais lenta
+#define TAM_PALAVRA 50        // Mesmo tamanho do NoBST
+
+// ============================================================================
+// ESTRUTURA 1: ÁRVORE BINÁRIA DE BUSCA (BST)
+// Lógica: Cada nó tem até 2 filhos. Menores à esquerda, maiores à direita.
+// ============================================================================
+
+typedef struct NoBST {
+    uint64_t prefixo;       // 8 primeiros bytes da palavra (big-endian), comparados antes do strcmp
+    struct NoBST* esquerda; // Ponteiro para subárvore com valores menores
+    struct NoBST* direita;  // Ponteiro para subárvore com valores maiores
+    char palavra[50];       // Dado armazenado (string)
+} NoBST;
+
+// Auxiliar: 8 primeiros bytes da palavra como inteiro big-endian (completa com zeros).
+// Comparar dois desses inteiros dá o mesmo resultado que strcmp nos 8 primeiros bytes.
+uint64_t prefixoChave(const char* palavra) {
+    uint64_t valor = 0;
+    int i = 0;
+    for (; i < 8 && palavra[i] != '\0'; i++) valor = (valor << 8) | (unsigned char)palavra[i];
+    for (; i < 8; i++) valor <<= 8;
+    return valor;
+}
+
+// Auxiliar: compara como strcmp, mas decide pelo prefixo sempre que possível.
+// Só lê o restante das strings quando os 8 primeiros bytes empatam.
+int compararChave(const char* palavra, uint64_t prefixo, NoBST* no) {
+    if (prefixo != no->prefixo) return (prefixo < no->prefixo) ? -1 : 1;
+    // Prefixos iguais: se o último byte é zero, a palavra acabou dentro dele e as duas são iguais
+    if ((prefixo & 0xFF) == 0) return 0;
+    return strcmp(palavra + 8, no->palavra + 8);
+}
+
+// Cria um novo nó para a BST
+NoBST* criarNoBST(char* palavra) {
+    NoBST* novo = (NoBST*)malloc(sizeof(NoBST));
+    if (novo) {
+        strcpy(novo->palavra, palavra);
+        novo->prefixo = prefixoChave(palavra);
+        novo->esquerda = NULL;
+        novo->direita = NULL;
+    }
+    return novo;
+}
+
+// Auxiliar recursivo da inserção: o prefixo da palavra é calculado uma única vez
+NoBST* inserirBSTComPrefixo(NoBST* raiz, char* palavra, uint64_t prefixo) {
+    // Caso base: encontrou um lugar vazio, insere aqui
+    if (raiz == NULL) return criarNoBST(palavra);
+
+    int cmp = compararChave(palavra, prefixo, raiz);
+
+    if (cmp < 0) {
+        // Se a palavra é "menor" (vem antes no alfabeto), vai para a esquerda
+        raiz->esquerda = inserirBSTComPrefixo(raiz->esquerda, palavra, prefixo);
+    } else if (cmp > 0) {
+        // Se a palavra é "maior", vai para a direita
+        raiz->direita = inserirBSTComPrefixo(raiz->direita, palavra, prefixo);
+    }
+    // Se cmp == 0, a palavra já existe (ignoramos duplicatas neste exemplo)
+    
+    return raiz;
+}
+
+// Insere uma string na BST mantendo a ordem alfabética (mesma ordem do strcmp)
+NoBST* inserirBST(NoBST* raiz, char* palavra) {
+    return inserirBSTComPrefixo(raiz, palavra, prefixoChave(palavra));
+}
+
+// Auxiliar recursivo da busca
+bool buscarBSTComPrefixo(NoBST* raiz, char* palavra, uint64_t prefixo) {
+    if (raiz == NULL) return false; // Chegou ao fim e não achou
+
+    int cmp = compararChave(palavra, prefixo, raiz);
+
+    if (cmp == 0) return true; // Achou!
+    else if (cmp < 0) return buscarBSTComPrefixo(raiz->esquerda, palavra, prefixo); // Busca na esquerda
+    else return buscarBSTComPrefixo(raiz->direita, palavra, prefixo); // Busca na direita
+}
+
+// Busca uma string na BST
+bool buscarBST(NoBST* raiz, char* palavra) {
+    return buscarBSTComPrefixo(raiz, palavra, prefixoChave(palavra));
+}
+
+// Conta os nós da BST (para estimar a memória ocupada)
+long contarNosBST(NoBST* raiz) {
+    if (raiz == NULL) return 0;
+    return 1 + contarNosBST(raiz->esquerda) + contarNosBST(raiz->direita);
+}
+
+// Libera memória da BST
+void liberarBST(NoBST* raiz) {
+    if (raiz != NULL) {
+        liberarBST(raiz->esquerda);
+        liberarBST(raiz->direita);
+        free(raiz);
+    }
+}
+
+
+// ============================================================================
+// EXPORTAÇÃO: BST EM ORDEM -> ARQUIVO FRONT-CODED
+// ============================================================================
+
+// Cabeçalho do arquivo
+typedef struct {
+    char magica[8];            // "BSTFC1\0\0"
+    uint32_t palavrasPorBloco;
+    uint32_t qtdPalavras;
+    uint32_t qtdBlocos;
+    uint32_t inicioIndice;     // Posição do índice de blocos no arquivo
+} CabecalhoFC;
+
+// Estado da exportação durante o percurso em ordem
+typedef struct {
+    FILE* arquivo;
+    char anterior[TAM_PALAVRA]; // Última palavra gravada
+    uint32_t posicao;           // Bytes já gravados
+    uint32_t qtdPalavras;
+    uint32_t* indice;           // Posição de cada bloco
+    uint32_t qtdBlocos;
+    uint32_t capacidadeIndice;
+    bool erro;
+} ExportadorFC;
+
+// Auxiliar: tamanho do prefixo comum entre duas palavras
+int prefixoComum(const char* a, const char* b) {
+    int i = 0;
+    while (a[i] != '\0' && a[i] == b[i] && i < 255) i++;
+    return i;
+}
+
+// Auxiliar: grava bytes e avança a posição
+void gravarBytes(ExportadorFC* exp, const void* dados, size_t tam) {
+    if (fwrite(dados, 1, tam, exp->arquivo) != tam) exp->erro = true;
+    exp->posicao += (uint32_t)tam;
+}
+
+// Grava uma palavra (as palavras chegam em ordem crescente)
+void exportarPalavra(ExportadorFC* exp, const char* palavra) {
+    unsigned char tamanhos[2];
+    int tam = (int)strlen(palavra);
+
+    if (exp->qtdPalavras % PALAVRAS_POR_BLOCO == 0) {
+        // Início de bloco: anota a posição no índice e grava a palavra inteira
+        if (exp->qtdBlocos == exp->capacidadeIndice) {
+            exp->capacidadeIndice *= 2;
+            uint32_t* maior = (uint32_t*)realloc(exp->indice, exp->capacidadeIndice * sizeof(uint32_t));
+            if (maior == NULL) {
+                printf("Erro crítico: Falha na alocação de memória.\n");
+                exit(1);
+            }
+            exp->indice = maior;
+        }
+        exp->indice[exp->qtdBlocos++] = exp->posicao;
+        tamanhos[0] = (unsigned char)tam;
+        gravarBytes(exp, tamanhos, 1);
+        gravarBytes(exp, palavra, tam);
+    } else {
+        int comum = prefixoComum(exp->anterior, palavra);
+        tamanhos[0] = (unsigned char)comum;
+        tamanhos[1] = (unsigned char)(tam - comum);
+        gravarBytes(exp, tamanhos, 2);
+        gravarBytes(exp, palavra + comum, tam - comum);
+    }
+    strcpy(exp->anterior, palavra);
+    exp->qtdPalavras++;
+}
+
+// Auxiliar recursivo: percurso Em Ordem (mesma ordem do emOrdemBST)
+void exportarEmOrdem(NoBST* raiz, ExportadorFC* exp) {
+    if (raiz != NULL) {
+        exportarEmOrdem(raiz->esquerda, exp);
+        exportarPalavra(exp, raiz->palavra);
+        exportarEmOrdem(raiz->direita, exp);
+    }
+}
+
+/*
+ * exportarBSTFrontCoding() – grava a BST inteira no arquivo.
+ * O formato usa a ordem de bytes da máquina (o arquivo é um cache local).
+ * Retorna true em caso de sucesso.
+ */
+bool exportarBSTFrontCoding(NoBST* raiz, const char* caminho) {
+    ExportadorFC exp;
+    memset(&exp, 0, sizeof(exp));
+    exp.arquivo = fopen(caminho, "wb");
+    if (exp.arquivo == NULL) return false;
+    exp.capacidadeIndice = 1024;
+    exp.indice = (uint32_t*)malloc(exp.capacidadeIndice * sizeof(uint32_t));
+    if (exp.indice == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+
+    // O cabeçalho é regravado no fim, quando os totais são conhecidos
+    CabecalhoFC cab;
+    memset(&cab, 0, sizeof(cab));
+    gravarBytes(&exp, &cab, sizeof(cab));
+
+    exportarEmOrdem(raiz, &exp);
+
+    // Alinha o índice em 4 bytes para ser lido direto do mapeamento
+    static const char zeros[4] = {0, 0, 0, 0};
+    gravarBytes(&exp, zeros, (4 - exp.posicao % 4) % 4);
+    memcpy(cab.magica, "BSTFC1", 7);
+    cab.palavrasPorBloco = PALAVRAS_POR_BLOCO;
+    cab.qtdPalavras = exp.qtdPalavras;
+    cab.qtdBlocos = exp.qtdBlocos;
+    cab.inicioIndice = exp.posicao;
+    gravarBytes(&exp, exp.indice, exp.qtdBlocos * sizeof(uint32_t));
+
+    if (fseek(exp.arquivo, 0, SEEK_SET) != 0 || fwrite(&cab, sizeof(cab), 1, exp.arquivo) != 1) exp.erro = true;
+    if (fclose(exp.arquivo) != 0) exp.erro = true;
+    free(exp.indice);
+    return !exp.erro;
+}
+
+// ============================================================================
+// CONSULTA: DICIONÁRIO MAPEADO
+// ============================================================================
+
+typedef struct {
+    const unsigned char* dados; // Arquivo inteiro (mmap ou buffer lido)
+    size_t bytes;
+    const uint32_t* indice;
+    uint32_t qtdBlocos;
+    uint32_t qtdPalavras;
+    uint32_t palavrasPorBloco;
+} DicionarioFC;
+
+/*
+ * carregarFC() – mapeia o arquivo; nenhum bloco é descomprimido.
+ * Retorna NULL se o arquivo não existir ou não for válido.
+ */
+DicionarioFC* carregarFC(const char* caminho) {
+    void* dados = NULL;
+    size_t bytes = 0;
+
+#ifdef _WIN32
+    FILE* arquivo = fopen(caminho, "rb");
+    if (arquivo == NULL) return NULL;
+    fseek(arquivo, 0, SEEK_END);
+    bytes = (size_t)ftell(arquivo);
+    fseek(arquivo, 0, SEEK_SET);
+    dados = malloc(bytes);
+    if (dados == NULL || fread(dados, 1, bytes, arquivo) != bytes) {
+        free(dados);
+        fclose(arquivo);
+        return NULL;
+    }
+    fclose(arquivo);
+#else
+    int fd = open(caminho, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return NULL;
+    }
+    bytes = (size_t)info.st_size;
+    dados = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // O mapeamento continua válido após fechar o descritor
+    if (dados == MAP_FAILED) return NULL;
+#endif
+
+    CabecalhoFC* cab = (CabecalhoFC*)dados;
+    bool valido = bytes >= sizeof(CabecalhoFC) && memcmp(cab->magica, "BSTFC1", 7) == 0 &&
+                  cab->palavrasPorBloco > 0 && cab->inicioIndice % 4 == 0 &&
+                  bytes == (size_t)cab->inicioIndice + (size_t)cab->qtdBlocos * sizeof(uint32_t);
+
+    DicionarioFC* dic = valido ? (DicionarioFC*)calloc(1, sizeof(DicionarioFC)) : NULL;
+    if (dic == NULL) {
+#ifdef _WIN32
+        free(dados);
+#else
+        munmap(dados, bytes);
+#endif
+        return NULL;
+    }
+    dic->dados = (const unsigned char*)dados;
+    dic->bytes = bytes;
+    dic->indice = (const uint32_t*)(dic->dados + cab->inicioIndice);
+    dic->qtdBlocos = cab->qtdBlocos;
+    dic->qtdPalavras = cab->qtdPalavras;
+    dic->palavrasPorBloco = cab->palavrasPorBloco;
+    return dic;
+}
+
+// Auxiliar: compara bytes (sem '\0') com uma string, com o mesmo resultado do strcmp
+int compararComString(const unsigned char* bytes, int tam, const char* palavra) {
+    for (int i = 0; i < tam; i++) {
+        unsigned char c = (unsigned char)palavra[i];
+        if (c == '\0') return 1; // A palavra acabou antes: os bytes são maiores
+        if (bytes[i] != c) return bytes[i] < c ? -1 : 1;
+    }
+    return palavra[tam] == '\0' ? 0 : -1;
+}
+
+// Busca uma palavra exata: busca binária nos blocos + um bloco decodificado
+bool buscarFC(const DicionarioFC* dic, const char* palavra) {
+    if (dic->qtdBlocos == 0) return false;
+
+    // 1. Último bloco cuja 1ª palavra é <= palavra
+    int esq = 0, dir = (int)dic->qtdBlocos - 1, bloco = -1;
+    while (esq <= dir) {
+        int meio = esq + (dir - esq) / 2;
+        const unsigned char* p = dic->dados + dic->indice[meio];
+        int cmp = compararComString(p + 1, p[0], palavra);
+        if (cmp == 0) return true;
+        if (cmp < 0) {
+            bloco = meio;
+            esq = meio + 1;
+        } else {
+            dir = meio - 1;
+        }
+    }
+    if (bloco < 0) return false; // Menor que a primeira palavra do dicionário
+
+    // 2. Decodifica o bloco até achar ou passar da palavra
+    const unsigned char* p = dic->dados + dic->indice[bloco];
+    unsigned char atual[256];
+    int tam = p[0];
+    memcpy(atual, p + 1, tam);
+    p += 1 + tam;
+    uint32_t restantes = dic->qtdPalavras - (uint32_t)bloco * dic->palavrasPorBloco;
+    if (restantes > dic->palavrasPorBloco) restantes = dic->palavrasPorBloco;
+    for (uint32_t i = 1; i < restantes; i++) {
+        int comum = p[0], sufixo = p[1];
+        memcpy(atual + comum, p + 2, sufixo);
+        tam = comum + sufixo;
+        p += 2 + sufixo;
+        int cmp = compararComString(atual, tam, palavra);
+        if (cmp == 0) return true;
+        if (cmp > 0) return false;
+    }
+    return false;
+}
+
+// Imprime todas as palavras em ordem (equivalente ao emOrdemBST)
+void emOrdemFC(const DicionarioFC* dic) {
+    unsigned char atual[257];
+    for (uint32_t b = 0; b < dic->qtdBlocos; b++) {
+        const unsigned char* p = dic->dados + dic->indice[b];
+        int tam = p[0];
+        memcpy(atual, p + 1, tam);
+        p += 1 + tam;
+        uint32_t restantes = dic->qtdPalavras - b * dic->palavrasPorBloco;
+        if (restantes > dic->palavrasPorBloco) restantes = dic->palavrasPorBloco;
+        for (uint32_t i = 0; i < restantes; i++) {
+            if (i > 0) {
+                int comum = p[0], sufixo = p[1];
+                memcpy(atual + comum, p + 2, sufixo);
+                tam = comum + sufixo;
+                p += 2 + sufixo;
+            }
+            atual[tam] = '\0';
+            printf("%s ", (char*)atual);
+        }
+    }
+}
+
+void liberarFC(DicionarioFC* dic) {
+    if (dic == NULL) return;
+#ifdef _WIN32
+    free((void*)dic->dados);
+#else
+    munmap((void*)dic->dados, dic->bytes);
+#endif
+    free(dic);
+}
+
+// ============================================================================
+// DICIONÁRIO DE TESTE
+// ============================================================================
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+// Lê uma palavra por linha (até 'maximo'). Retorna a quantidade lida.
+int carregarPalavras(const char* caminho, char** palavras, int maximo) {
+    FILE* arquivo = fopen(caminho, "r");
+    if (arquivo == NULL) return 0;
+    char linha[256];
+    int qtd = 0;
+    while (qtd < maximo && fgets(linha, sizeof(linha), arquivo)) {
+        if (strchr(linha, '\n') == NULL && !feof(arquivo)) {
+            int c;
+            while ((c = fgetc(arquivo)) != '\n' && c != EOF); // Descarta o resto da linha longa
+            continue;
+        }
+        linha[strcspn(linha, "\r\n")] = '\0';
+        if (linha[0] == '\0' || strlen(linha) >= TAM_PALAVRA) continue;
+        strcpy(palavras[qtd++], linha);
+    }
+    fclose(arquivo);
+    return qtd;
+}
+
+// Palavras de 2 a 6 sílabas
+void gerarPalavras(char** palavras, int qtd) {
+    const char* silabas[] = {
+        "ca", "sa", "ro", "mi", "nha", "de", "to", "pe", "li", "ra",
+        "bo", "ma", "te", "co", "la", "ve", "ne", "di", "so", "pa",
+        "men", "tra", "gu", "fi", "ção", "ar", "es", "in", "con", "por"
+    };
+    for (int i = 0; i < qtd; i++) {
+        palavras[i][0] = '\0';
+        int partes = 2 + rand() % 5;
+        for (int p = 0; p < partes; p++) strcat(palavras[i], silabas[rand() % 30]);
+    }
+}
+
+// Embaralha (Fisher-Yates) para a BST não degenerar em lista
+void embaralhar(char** palavras, int qtd) {
+    for (int i = qtd - 1; i > 0; i--) {
+        int j = aleatorio() % (i + 1);
+        char* temp = palavras[i];
+        palavras[i] = palavras[j];
+        palavras[j] = temp;
+    }
+}
+
+// ============================================================================
+// MAIN: TESTES E COMPARAÇÃO
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    const char* arquivoSaida = (argc > 2) ? argv[2] : "dicionario_bst.fc";
+    bool saidaTemporaria = (argc <= 2);
+
+    printf("========================================================\n");
+    printf("     BST -> DICIONARIO FRONT-CODED (BUSCA NO DISCO)\n");
+    printf("========================================================\n");
+
+    // ------------------------------------------------------------
+    // TESTE 1: Mesmas palavras do BST_TRIE.c
+    // ------------------------------------------------------------
+    char* exemplos[] = {"casa", "carro", "caminhao", "arvore", "dado", "bola"};
+    NoBST* raizExemplo = NULL;
+    for (int i = 0; i < 6; i++) raizExemplo = inserirBST(raizExemplo, exemplos[i]);
+    if (!exportarBSTFrontCoding(raizExemplo, arquivoSaida)) {
+        printf("[ERRO] Não foi possível gravar '%s'.\n", arquivoSaida);
+        return 1;
+    }
+    liberarBST(raizExemplo);
+
+    DicionarioFC* dicExemplo = carregarFC(arquivoSaida);
+    if (dicExemplo == NULL) {
+        printf("[ERRO] Não foi possível carregar '%s'.\n", arquivoSaida);
+        if (saidaTemporaria) remove(arquivoSaida);
+        return 1;
+    }
+    printf("Arquivo com %zu bytes. Em ordem: ", dicExemplo->bytes);
+    emOrdemFC(dicExemplo);
+    printf("\n");
+    char* buscas[] = {"carro", "caminh", "arvore", "zebra", "abacate"};
+    for (int i = 0; i < 5; i++) {
+        printf("Busca '%s': %s\n", buscas[i], buscarFC(dicExemplo, buscas[i]) ? "ENCONTRADO" : "NAO ENCONTRADO");
+    }
+    liberarFC(dicExemplo);
+
+    // ------------------------------------------------------------
+    // TESTE 2: Dicionário grande
+    // ------------------------------------------------------------
+    int maximo = 1000000;
+    char** palavras = (char**)malloc(maximo * sizeof(char*));
+    for (int i = 0; i < maximo; i++) palavras[i] = (char*)malloc(TAM_PALAVRA);
+    srand(42);
+    int qtd = 0;
+    if (argc > 1) qtd = carregarPalavras(argv[1], palavras, maximo);
+    if (qtd == 0) {
+        if (argc > 1) printf("\nNão foi possível ler '%s'. Usando dicionário sintético.\n", argv[1]);
+        qtd = maximo;
+        gerarPalavras(palavras, qtd);
+    }
+    embaralhar(palavras, qtd);
+
+    NoBST* raiz = NULL;
+    for (int i = 0; i < qtd; i++) raiz = inserirBST(raiz, palavras[i]);
+    long qtdNos = contarNosBST(raiz);
+
+    // Consultas: metade existentes, metade ausentes (palavra + "x")
+    char** consultas = (char**)malloc(maximo * sizeof(char*));
+    for (int i = 0; i < qtd; i++) {
+        consultas[i] = (char*)malloc(TAM_PALAVRA + 2);
+        strcpy(consultas[i], palavras[aleatorio() % qtd]);
+        if (i % 2) strcat(consultas[i], "x");
+    }
+
+    clock_t inicio = clock();
+    bool exportou = exportarBSTFrontCoding(raiz, arquivoSaida);
+    clock_t fim = clock();
+    double tempoExportacao = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    DicionarioFC* dic = exportou ? carregarFC(arquivoSaida) : NULL;
+    fim = clock();
+    double tempoCarga = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    if (dic == NULL) {
+        printf("[ERRO] Não foi possível gravar ou carregar '%s'.\n", arquivoSaida);
+        if (saidaTemporaria) remove(arquivoSaida);
+        return 1;
+    }
+
+    long acertosBST = 0, acertosFC = 0;
+    inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosBST += buscarBST(raiz, consultas[i]);
+    fim = clock();
+    double buscaBST = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosFC += buscarFC(dic, consultas[i]);
+    fim = clock();
+    double buscaFC = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    long bytesTexto = 0; // Uma palavra por linha, como um .txt
+    for (long i = 0; i < qtd; i++) bytesTexto += (long)strlen(palavras[i]) + 1;
+
+    printf("\n--- Dicionário com %ld palavras distintas ---\n", qtdNos);
+    printf("Exportacao: %f s | Carga (mmap): %f s\n", tempoExportacao, tempoCarga);
+    printf("%-22s %15s %15s\n", "", "BST", "Front-coded");
+    printf("%-22s %15.1f %15.1f\n", "Memoria/disco (MB)",
+           qtdNos * (double)sizeof(NoBST) / (1024.0 * 1024.0), dic->bytes / (1024.0 * 1024.0));
+    printf("%-22s %15.1f %15.1f\n", "ns por busca", buscaBST * 1e9 / qtd, buscaFC * 1e9 / qtd);
+    printf("Lista de entrada (uma por linha, com repeticoes): %.1f MB\n", bytesTexto / (1024.0 * 1024.0));
+    printf("Resultados %s (%ld encontradas)\n", acertosBST == acertosFC ? "CONFEREM" : "DIVERGEM (ERRO!)", acertosFC);
+
+    liberarFC(dic); // Desmapeia antes de apagar (exigido no Windows)
+    if (saidaTemporaria) remove(arquivoSaida);
+    liberarBST(raiz);
+    for (int i = 0; i < qtd; i++) free(consultas[i]);
+    for (int i = 0; i < maximo; i++) free(palavras[i]);
+    free(consultas);
+    free(palavras);
+    printf("\nMemoria liberada. Fim do programa.\n");
+    return 0;
+}
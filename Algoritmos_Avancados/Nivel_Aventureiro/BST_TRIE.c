@@ -2,13 +2,27 @@
  * Objetivo: Comparar a implementação e lógica de duas estruturas de dados fundamentais:
  * 1. BST (Binary Search Tree): Ótima para ordenação e busca geral.
  * 2. Trie (Prefix Tree): Especializada em strings e busca por prefixos.
+ * 3. ART (Adaptive Radix Tree): Trie com nós de tamanho adaptável e caminhos comprimidos.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <ctype.h>
+#ifdef __SSE2__
+#include <emmintrin.h> // Comparação de 16 bytes de uma vez no Node16 da ART
+#endif
+
+// Pede ao processador para trazer o endereço para o cache sem esperar por ele
+#if defined(__GNUC__)
+#define PREFETCH(p) __builtin_prefetch(p)
+#else
+#define PREFETCH(p) ((void)0)
+#endif
+
+#define MAX_GRUPO 64 // Máximo de buscas intercaladas nas buscas em lote
 
 // ============================================================================
 // ESTRUTURA 1: ÁRVORE BINÁRIA DE BUSCA (BST)
@@ -16,50 +30,138 @@
 // ============================================================================
 
 typedef struct NoBST {
-    char palavra[50];       // Dado armazenado (string)
+    uint64_t prefixo;       // 8 primeiros bytes da palavra (big-endian), comparados antes do strcmp
     struct NoBST* esquerda; // Ponteiro para subárvore com valores menores
     struct NoBST* direita;  // Ponteiro para subárvore com valores maiores
+    char palavra[50];       // Dado armazenado (string)
 } NoBST;
 
+// Auxiliar: 8 primeiros bytes da palavra como inteiro big-endian (completa com zeros).
+// Comparar dois desses inteiros dá o mesmo resultado que strcmp nos 8 primeiros bytes.
+uint64_t prefixoChave(const char* palavra) {
+    uint64_t valor = 0;
+    int i = 0;
+    for (; i < 8 && palavra[i] != '\0'; i++) valor = (valor << 8) | (unsigned char)palavra[i];
+    for (; i < 8; i++) valor <<= 8;
+    return valor;
+}
+
+// Auxiliar: compara como strcmp, mas decide pelo prefixo sempre que possível.
+// Só lê o restante das strings quando os 8 primeiros bytes empatam.
+int compararChave(const char* palavra, uint64_t prefixo, NoBST* no) {
+    if (prefixo != no->prefixo) return (prefixo < no->prefixo) ? -1 : 1;
+    // Prefixos iguais: se o último byte é zero, a palavra acabou dentro dele e as duas são iguais
+    if ((prefixo & 0xFF) == 0) return 0;
+    return strcmp(palavra + 8, no->palavra + 8);
+}
+
 // Cria um novo nó para a BST
 NoBST* criarNoBST(char* palavra) {
     NoBST* novo = (NoBST*)malloc(sizeof(NoBST));
     if (novo) {
         strcpy(novo->palavra, palavra);
+        novo->prefixo = prefixoChave(palavra);
         novo->esquerda = NULL;
         novo->direita = NULL;
     }
     return novo;
 }
 
-// Insere uma string na BST mantendo a ordem alfabética (strcmp)
-NoBST* inserirBST(NoBST* raiz, char* palavra) {
+// Auxiliar recursivo da inserção: o prefixo da palavra é calculado uma única vez
+NoBST* inserirBSTComPrefixo(NoBST* raiz, char* palavra, uint64_t prefixo) {
     // Caso base: encontrou um lugar vazio, insere aqui
     if (raiz == NULL) return criarNoBST(palavra);
 
-    int cmp = strcmp(palavra, raiz->palavra);
+    int cmp = compararChave(palavra, prefixo, raiz);
 
     if (cmp < 0) {
         // Se a palavra é "menor" (vem antes no alfabeto), vai para a esquerda
-        raiz->esquerda = inserirBST(raiz->esquerda, palavra);
+        raiz->esquerda = inserirBSTComPrefixo(raiz->esquerda, palavra, prefixo);
     } else if (cmp > 0) {
         // Se a palavra é "maior", vai para a direita
-        raiz->direita = inserirBST(raiz->direita, palavra);
+        raiz->direita = inserirBSTComPrefixo(raiz->direita, palavra, prefixo);
     }
     // Se cmp == 0, a palavra já existe (ignoramos duplicatas neste exemplo)
     
     return raiz;
 }
 
-// Busca uma string na BST
-bool buscarBST(NoBST* raiz, char* palavra) {
+// Insere uma string na BST mantendo a ordem alfabética (mesma ordem do strcmp)
+NoBST* inserirBST(NoBST* raiz, char* palavra) {
+    return inserirBSTComPrefixo(raiz, palavra, prefixoChave(palavra));
+}
+
+// Auxiliar recursivo da busca
+bool buscarBSTComPrefixo(NoBST* raiz, char* palavra, uint64_t prefixo) {
     if (raiz == NULL) return false; // Chegou ao fim e não achou
 
-    int cmp = strcmp(palavra, raiz->palavra);
+    int cmp = compararChave(palavra, prefixo, raiz);
 
     if (cmp == 0) return true; // Achou!
-    else if (cmp < 0) return buscarBST(raiz->esquerda, palavra); // Busca na esquerda
-    else return buscarBST(raiz->direita, palavra); // Busca na direita
+    else if (cmp < 0) return buscarBSTComPrefixo(raiz->esquerda, palavra, prefixo); // Busca na esquerda
+    else return buscarBSTComPrefixo(raiz->direita, palavra, prefixo); // Busca na direita
+}
+
+// Busca uma string na BST
+bool buscarBST(NoBST* raiz, char* palavra) {
+    return buscarBSTComPrefixo(raiz, palavra, prefixoChave(palavra));
+}
+
+// --- Busca em Lote na BST ---
+// Uma busca sozinha passa a maior parte do tempo esperando o próximo nó chegar
+// da memória, e só depois sabe qual é o seguinte. Aqui até 'tamGrupo' buscas
+// independentes avançam intercaladas: cada uma dá um passo, pede o seu próximo
+// nó com PREFETCH e cede a vez. Quando ela for atendida de novo, o nó já deve
+// estar no cache, e as esperas de buscas diferentes se sobrepõem.
+// encontrados[i] recebe o resultado de palavras[i].
+void buscarBSTLote(NoBST* raiz, char** palavras, int qtd, int tamGrupo, bool* encontrados) {
+    NoBST* atual[MAX_GRUPO];
+    uint64_t prefixo[MAX_GRUPO];
+    int consulta[MAX_GRUPO]; // Índice da palavra em cada posição do grupo (-1 = livre)
+    if (tamGrupo < 1) tamGrupo = 1;
+    if (tamGrupo > MAX_GRUPO) tamGrupo = MAX_GRUPO;
+
+    int proxima = 0, ativas = 0;
+    for (int g = 0; g < tamGrupo; g++) {
+        consulta[g] = -1;
+        if (proxima < qtd) {
+            consulta[g] = proxima;
+            prefixo[g] = prefixoChave(palavras[proxima]);
+            atual[g] = raiz;
+            proxima++;
+            ativas++;
+        }
+    }
+    PREFETCH(raiz);
+
+    while (ativas > 0) {
+        for (int g = 0; g < tamGrupo; g++) {
+            int c = consulta[g];
+            if (c < 0) continue;
+
+            NoBST* no = atual[g];
+            if (no != NULL) {
+                int cmp = compararChave(palavras[c], prefixo[g], no);
+                if (cmp != 0) {
+                    // Ainda não terminou: desce um nível e pede o próximo nó
+                    atual[g] = (cmp < 0) ? no->esquerda : no->direita;
+                    PREFETCH(atual[g]);
+                    continue;
+                }
+            }
+            // Terminou (achou ou chegou a NULL): a posição recebe a próxima palavra
+            encontrados[c] = (no != NULL);
+            if (proxima < qtd) {
+                consulta[g] = proxima;
+                prefixo[g] = prefixoChave(palavras[proxima]);
+                atual[g] = raiz;
+                proxima++;
+            } else {
+                consulta[g] = -1;
+                ativas--;
+            }
+        }
+    }
 }
 
 // --- Percursos da BST ---
@@ -92,6 +194,12 @@ void posOrdemBST(NoBST* raiz) {
     }
 }
 
+// Conta os nós da BST (para estimar a memória ocupada)
+long contarNosBST(NoBST* raiz) {
+    if (raiz == NULL) return 0;
+    return 1 + contarNosBST(raiz->esquerda) + contarNosBST(raiz->direita);
+}
+
 // Libera memória da BST
 void liberarBST(NoBST* raiz) {
     if (raiz != NULL) {
@@ -103,31 +211,99 @@ void liberarBST(NoBST* raiz) {
 
 // ============================================================================
 // ESTRUTURA 2: TRIE (ÁRVORE DE PREFIXOS)
-// Lógica: Cada nó representa uma letra. O caminho da raiz até um nó forma a palavra.
+// Lógica: Cada nó representa um byte. O caminho da raiz até um nó forma a palavra.
+// Aceita qualquer byte, então palavras em UTF-8 ("avião") são guardadas como
+// a sequência de bytes de cada caractere.
 // ============================================================================
 
-#define TAM_ALFABETO 26 // Considerando apenas letras minúsculas a-z
+#define TAM_ALFABETO 256 // Um filho possível para cada valor de byte
 
 typedef struct NoTrie {
-    struct NoTrie* filhos[TAM_ALFABETO]; // Vetor de ponteiros para as próximas letras
-    bool fimDaPalavra;                   // Marca se este nó encerra uma palavra válida
+    uint64_t mapa[4];         // 256 bits: bit b ligado = existe filho para o byte b
+    struct NoTrie** filhos;   // Somente os filhos que existem, em ordem crescente de byte
+    unsigned short qtdFilhos; // Tamanho do vetor filhos
+    bool fimDaPalavra;        // Marca se este nó encerra uma palavra válida
 } NoTrie;
 
+// Com 256 ponteiros fixos cada nó teria mais de 2 KB. Aqui o nó tem
+// 32 bytes de mapa + um ponteiro por filho existente.
+
+// Auxiliar: quantidade de bits ligados em uma palavra de 64 bits
+int contarBits(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int total = 0;
+    while (x) { x &= x - 1; total++; }
+    return total;
+#endif
+}
+
+// Auxiliar: índice do bit ligado mais baixo (x != 0)
+int indiceMenorBit(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int i = 0;
+    while (!(x & 1)) { x >>= 1; i++; }
+    return i;
+#endif
+}
+
+// Auxiliar: posição do filho do byte b no vetor denso.
+// É o número de filhos com byte menor que b (bits ligados antes de b no mapa).
+int posicaoFilho(NoTrie* no, int b) {
+    int palavra = b >> 6;
+    uint64_t antes = no->mapa[palavra] & ((1ULL << (b & 63)) - 1);
+    int pos = contarBits(antes);
+    for (int i = 0; i < palavra; i++) pos += contarBits(no->mapa[i]);
+    return pos;
+}
+
+// Auxiliar: retorna o filho do byte b ou NULL
+NoTrie* obterFilho(NoTrie* no, int b) {
+    if (!(no->mapa[b >> 6] & (1ULL << (b & 63)))) return NULL;
+    return no->filhos[posicaoFilho(no, b)];
+}
+
 // Cria um novo nó para a Trie
 NoTrie* criarNoTrie() {
     NoTrie* novo = (NoTrie*)malloc(sizeof(NoTrie));
     if (novo) {
         novo->fimDaPalavra = false;
-        for (int i = 0; i < TAM_ALFABETO; i++) {
-            novo->filhos[i] = NULL; // Inicializa todos os filhos como NULL
+        for (int i = 0; i < 4; i++) {
+            novo->mapa[i] = 0; // Nenhum filho ainda
         }
+        novo->filhos = NULL;
+        novo->qtdFilhos = 0;
     }
     return novo;
 }
 
-// Auxiliar: Converte char para índice (0 a 25)
+// Auxiliar: cria o filho do byte b mantendo o vetor denso ordenado
+NoTrie* adicionarFilho(NoTrie* no, int b) {
+    NoTrie* filho = criarNoTrie();
+    NoTrie** novos = (NoTrie**)realloc(no->filhos, (no->qtdFilhos + 1) * sizeof(NoTrie*));
+    if (filho == NULL || novos == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    int pos = posicaoFilho(no, b);
+    // Abre espaço deslocando os filhos de byte maior uma posição para a direita
+    memmove(&novos[pos + 1], &novos[pos], (no->qtdFilhos - pos) * sizeof(NoTrie*));
+    novos[pos] = filho;
+    no->filhos = novos;
+    no->qtdFilhos++;
+    no->mapa[b >> 6] |= 1ULL << (b & 63);
+    return filho;
+}
+
+// Auxiliar: Converte char para índice (0 a 255).
+// Letras ASCII viram minúsculas; os demais bytes (inclusive UTF-8) são mantidos.
 int charParaIndice(char c) {
-    return tolower(c) - 'a';
+    unsigned char b = (unsigned char)c;
+    if (b < 128) return tolower(b);
+    return b;
 }
 
 // Insere uma palavra na Trie
@@ -136,16 +312,14 @@ void inserirTrie(NoTrie* raiz, char* palavra) {
     
     for (int i = 0; palavra[i] != '\0'; i++) {
         int indice = charParaIndice(palavra[i]);
-        
-        // Validação simples para garantir que é letra
-        if (indice < 0 || indice >= TAM_ALFABETO) continue;
 
-        // Se não existe o caminho para essa letra, cria
-        if (atual->filhos[indice] == NULL) {
-            atual->filhos[indice] = criarNoTrie();
+        // Se não existe o caminho para esse byte, cria
+        NoTrie* proximo = obterFilho(atual, indice);
+        if (proximo == NULL) {
+            proximo = adicionarFilho(atual, indice);
         }
         // Avança para o próximo nó
-        atual = atual->filhos[indice];
+        atual = proximo;
     }
     // Marca o último nó como fim de uma palavra completa
     atual->fimDaPalavra = true;
@@ -156,39 +330,741 @@ bool buscarTrie(NoTrie* raiz, char* palavra) {
     NoTrie* atual = raiz;
     
     for (int i = 0; palavra[i] != '\0'; i++) {
-        int indice = charParaIndice(palavra[i]);
-        
-        if (indice < 0 || indice >= TAM_ALFABETO) return false;
-
         // Se o caminho for interrompido (NULL), a palavra não existe
-        if (atual->filhos[indice] == NULL) {
+        atual = obterFilho(atual, charParaIndice(palavra[i]));
+        if (atual == NULL) {
             return false;
         }
-        atual = atual->filhos[indice];
     }
     // Retorna true apenas se chegamos ao final E estiver marcado como fim de palavra
     return (atual != NULL && atual->fimDaPalavra);
 }
 
+// --- Busca em Lote na Trie ---
+// Mesma ideia do buscarBSTLote. Na Trie cada nível tem duas leituras
+// dependentes: o nó (mapa) e depois o vetor de filhos, que é outra alocação.
+// Por isso cada busca alterna entre duas etapas, e cada etapa termina pedindo
+// com PREFETCH o endereço que a próxima etapa vai ler.
+void buscarTrieLote(NoTrie* raiz, char** palavras, int qtd, int tamGrupo, bool* encontrados) {
+    NoTrie* atual[MAX_GRUPO];
+    int posicao[MAX_GRUPO];  // Posição do filho no vetor denso (-1 = ainda falta ler o mapa)
+    int letra[MAX_GRUPO];    // Próximo byte da palavra a consumir
+    int consulta[MAX_GRUPO]; // Índice da palavra em cada posição do grupo (-1 = livre)
+    if (tamGrupo < 1) tamGrupo = 1;
+    if (tamGrupo > MAX_GRUPO) tamGrupo = MAX_GRUPO;
+
+    int proxima = 0, ativas = 0;
+    for (int g = 0; g < tamGrupo; g++) {
+        consulta[g] = -1;
+        if (proxima < qtd) {
+            consulta[g] = proxima++;
+            atual[g] = raiz;
+            posicao[g] = -1;
+            letra[g] = 0;
+            ativas++;
+        }
+    }
+
+    while (ativas > 0) {
+        for (int g = 0; g < tamGrupo; g++) {
+            int c = consulta[g];
+            if (c < 0) continue;
+
+            NoTrie* no = atual[g];
+            if (posicao[g] >= 0) {
+                // Etapa 2: o vetor de filhos já foi pedido; desce e pede o filho
+                atual[g] = no->filhos[posicao[g]];
+                posicao[g] = -1;
+                letra[g]++;
+                PREFETCH(atual[g]);
+                continue;
+            }
+
+            // Etapa 1: lê o mapa do nó
+            char ch = palavras[c][letra[g]];
+            bool terminou, achou = false;
+            if (ch == '\0') {
+                terminou = true;
+                achou = no->fimDaPalavra;
+            } else {
+                int b = charParaIndice(ch);
+                terminou = !(no->mapa[b >> 6] & (1ULL << (b & 63)));
+                if (!terminou) {
+                    posicao[g] = posicaoFilho(no, b);
+                    PREFETCH(&no->filhos[posicao[g]]);
+                }
+            }
+            if (!terminou) continue;
+
+            encontrados[c] = achou;
+            if (proxima < qtd) {
+                consulta[g] = proxima++;
+                atual[g] = raiz;
+                letra[g] = 0;
+            } else {
+                consulta[g] = -1;
+                ativas--;
+            }
+        }
+    }
+}
+
+// --- Busca por Prefixo na Trie ---
+
+#define TAM_INICIAL_BUFFER 64 // O buffer que remonta as palavras cresce conforme a profundidade
+
+// Buffer da palavra sendo remontada. inserirTrie aceita palavras de qualquer
+// tamanho, então a listagem não pode ter uma profundidade máxima fixa.
+typedef struct {
+    char* texto;
+    int capacidade;
+} BufferPalavra;
+
+// Auxiliar: garante espaço para 'tam' bytes mais o '\0' (dobra a capacidade)
+void garantirBuffer(BufferPalavra* buffer, int tam) {
+    if (tam < buffer->capacidade) return;
+    int capacidade = buffer->capacidade ? buffer->capacidade : TAM_INICIAL_BUFFER;
+    while (capacidade <= tam) capacidade *= 2;
+    char* novo = (char*)realloc(buffer->texto, capacidade);
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    buffer->texto = novo;
+    buffer->capacidade = capacidade;
+}
+
+// Tipo da função chamada para cada palavra encontrada.
+// Deve retornar true para continuar ou false para interromper a listagem.
+typedef bool (*VisitarPalavra)(char* palavra, void* contexto);
+
+// Auxiliar recursivo: visita a subárvore em ordem crescente de byte
+// (para UTF-8 isso coincide com a ordem dos pontos de código).
+// Retorna false se a listagem foi interrompida pelo visitante.
+bool percorrerSubarvoreTrie(NoTrie* no, BufferPalavra* buffer, int tam, VisitarPalavra visitar, void* contexto, int* entregues) {
+    garantirBuffer(buffer, tam + 1);
+    if (no->fimDaPalavra) {
+        buffer->texto[tam] = '\0';
+        (*entregues)++;
+        if (!visitar(buffer->texto, contexto)) return false;
+    }
+
+    // Percorre os bits ligados do mapa; o k-ésimo bit é o k-ésimo filho do vetor
+    int k = 0;
+    for (int p = 0; p < 4; p++) {
+        uint64_t bits = no->mapa[p];
+        while (bits) {
+            int b = p * 64 + indiceMenorBit(bits);
+            bits &= bits - 1; // Desliga o bit já visitado
+
+            buffer->texto[tam] = (char)b;
+            if (!percorrerSubarvoreTrie(no->filhos[k++], buffer, tam + 1, visitar, contexto, entregues)) return false;
+        }
+    }
+    return true;
+}
+
+// Lista, em ordem crescente, todas as palavras que começam com o prefixo.
+// A listagem para assim que o visitante retornar false (ex: "só as 10 primeiras").
+// Retorna quantas palavras foram entregues ao visitante.
+int listarPrefixoTrie(NoTrie* raiz, char* prefixo, VisitarPalavra visitar, void* contexto) {
+    BufferPalavra buffer = {NULL, 0};
+    garantirBuffer(&buffer, (int)strlen(prefixo));
+    int tam = 0;
+    NoTrie* atual = raiz;
+
+    // 1. Desce até o nó do prefixo (mesmas regras de buscarTrie)
+    for (int i = 0; prefixo[i] != '\0'; i++) {
+        int indice = charParaIndice(prefixo[i]);
+        atual = obterFilho(atual, indice);
+        if (atual == NULL) {
+            free(buffer.texto);
+            return 0;
+        }
+        buffer.texto[tam++] = (char)indice;
+    }
+
+    // 2. Percorre a subárvore a partir do nó do prefixo
+    int entregues = 0;
+    percorrerSubarvoreTrie(atual, &buffer, tam, visitar, contexto, &entregues);
+    free(buffer.texto);
+    return entregues;
+}
+
+// --- Busca Aproximada (Distância de Edição) na Trie ---
+
+// Estado compartilhado por toda a busca (evita uma lista longa de parâmetros).
+// Os vetores são alocados pelo tamanho da consulta: como a distância nunca é
+// menor que a diferença de tamanhos, a busca não desce além de m + k + 1 bytes.
+typedef struct {
+    int* consulta;                 // Bytes da consulta já normalizados (charParaIndice)
+    int tamConsulta;
+    int k;                         // Distância máxima aceita
+    int* linhas;                   // Linha da profundidade d em linhas + d * (tamConsulta + 1)
+    char* buffer;                  // Palavra sendo remontada
+    VisitarPalavra visitar;
+    void* contexto;
+    int entregues;
+    long nosVisitados;
+} BuscaAproximada;
+
+// Auxiliar recursivo: 'linhaPai' guarda a distância entre o caminho até o pai
+// e cada prefixo da consulta (linhaPai[j] = prefixo de tamanho j).
+// Retorna false se a listagem foi interrompida pelo visitante.
+bool buscarAproximadoRec(NoTrie* no, int b, int* linhaPai, int tam, BuscaAproximada* busca) {
+    int m = busca->tamConsulta;
+    int* linha = busca->linhas + (size_t)tam * (m + 1);
+    busca->nosVisitados++;
+    busca->buffer[tam - 1] = (char)b;
+
+    linha[0] = linhaPai[0] + 1;
+    int menor = linha[0];
+    for (int j = 1; j <= m; j++) {
+        int custo = (busca->consulta[j - 1] == b) ? 0 : 1;
+        int valor = linhaPai[j - 1] + custo;                       // Troca (ou igual)
+        if (linhaPai[j] + 1 < valor) valor = linhaPai[j] + 1;     // Remoção
+        if (linha[j - 1] + 1 < valor) valor = linha[j - 1] + 1;   // Inserção
+        linha[j] = valor;
+        if (valor < menor) menor = valor;
+    }
+
+    if (no->fimDaPalavra && linha[m] <= busca->k) {
+        busca->buffer[tam] = '\0';
+        busca->entregues++;
+        if (!busca->visitar(busca->buffer, busca->contexto)) return false;
+    }
+    // Poda: a distância nunca diminui ao descer, então a subárvore inteira fica de fora.
+    // Com tam > m + k, menor >= tam - m > k: a profundidade fica limitada sem corte fixo.
+    if (menor > busca->k) return true;
+
+    int k = 0;
+    for (int p = 0; p < 4; p++) {
+        uint64_t bits = no->mapa[p];
+        while (bits) {
+            int filho = p * 64 + indiceMenorBit(bits);
+            bits &= bits - 1;
+            if (!buscarAproximadoRec(no->filhos[k++], filho, linha, tam + 1, busca)) return false;
+        }
+    }
+    return true;
+}
+
+// Entrega, em ordem crescente, todas as palavras a distância de edição <= k da consulta.
+// Se nosVisitados não for NULL, recebe quantos nós da Trie foram examinados.
+// Retorna quantas palavras foram entregues ao visitante.
+int buscarAproximadoTrie(NoTrie* raiz, char* consulta, int k, VisitarPalavra visitar, void* contexto, long* nosVisitados) {
+    BuscaAproximada busca;
+    int m = (int)strlen(consulta);
+    int profundidade = m + (k > 0 ? k : 0) + 2; // Linhas: profundidades 0 .. m + k + 1
+    busca.consulta = (int*)malloc((m + 1) * sizeof(int));
+    busca.linhas = (int*)malloc((size_t)profundidade * (m + 1) * sizeof(int));
+    busca.buffer = (char*)malloc(profundidade);
+    if (busca.consulta == NULL || busca.linhas == NULL || busca.buffer == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    busca.tamConsulta = m;
+    for (int i = 0; i < m; i++) busca.consulta[i] = charParaIndice(consulta[i]);
+    busca.k = k;
+    busca.visitar = visitar;
+    busca.contexto = contexto;
+    busca.entregues = 0;
+    busca.nosVisitados = 1;
+
+    // Linha da raiz (palavra vazia): apagar os j primeiros bytes da consulta custa j
+    int* linha = busca.linhas;
+    for (int j = 0; j <= m; j++) linha[j] = j;
+
+    bool continuar = true;
+    if (raiz->fimDaPalavra && busca.tamConsulta <= k) {
+        busca.buffer[0] = '\0';
+        busca.entregues++;
+        continuar = visitar(busca.buffer, contexto);
+    }
+    int idx = 0;
+    for (int p = 0; p < 4 && continuar; p++) {
+        uint64_t bits = raiz->mapa[p];
+        while (bits && continuar) {
+            int filho = p * 64 + indiceMenorBit(bits);
+            bits &= bits - 1;
+            continuar = buscarAproximadoRec(raiz->filhos[idx++], filho, linha, 1, &busca);
+        }
+    }
+    if (nosVisitados != NULL) *nosVisitados = busca.nosVisitados;
+    free(busca.consulta);
+    free(busca.linhas);
+    free(busca.buffer);
+    return busca.entregues;
+}
+
+// Calcula nós e bytes ocupados pela Trie (sem o cabeçalho interno do malloc)
+void medirTrie(NoTrie* raiz, long* qtdNos, long* bytes) {
+    if (raiz == NULL) return;
+    (*qtdNos)++;
+    *bytes += sizeof(NoTrie) + raiz->qtdFilhos * sizeof(NoTrie*);
+    for (int i = 0; i < raiz->qtdFilhos; i++) {
+        medirTrie(raiz->filhos[i], qtdNos, bytes);
+    }
+}
+
 // Libera memória da Trie (Recursivo)
 void liberarTrie(NoTrie* raiz) {
     if (raiz == NULL) return;
-    for (int i = 0; i < TAM_ALFABETO; i++) {
+    for (int i = 0; i < raiz->qtdFilhos; i++) {
         liberarTrie(raiz->filhos[i]);
     }
+    free(raiz->filhos);
     free(raiz);
 }
 
+// ============================================================================
+// ESTRUTURA 3: ADAPTIVE RADIX TREE (ART)
+// Lógica: Trie por bytes em que cada nó interno muda de tamanho conforme o
+// número de filhos (4, 16, 48 ou 256). Caminhos sem bifurcação viram um
+// prefixo guardado no nó (compressão de caminho) e uma palavra sozinha fica
+// direto em uma folha, sem criar nós até o fim dela (expansão preguiçosa).
+// A chave inclui o '\0' final, então nenhuma palavra é prefixo de outra.
+// ============================================================================
+
+#define ART_NO4   1
+#define ART_NO16  2
+#define ART_NO48  3
+#define ART_NO256 4
+#define MAX_PREFIXO_ART 8 // Bytes de prefixo guardados no nó (o restante é conferido na folha)
+
+// Cabeçalho comum a todos os nós internos
+typedef struct NoART {
+    uint8_t tipo;
+    uint16_t qtdFilhos;
+    uint32_t tamPrefixo;                    // Tamanho real do prefixo comprimido
+    unsigned char prefixo[MAX_PREFIXO_ART]; // Primeiros bytes desse prefixo
+} NoART;
+
+typedef struct {
+    NoART cab;
+    unsigned char chaves[4];   // Bytes dos filhos, em ordem crescente
+    void* filhos[4];
+} NoART4;
+
+typedef struct {
+    NoART cab;
+    unsigned char chaves[16];  // Comparadas de uma vez com SSE2
+    void* filhos[16];
+} NoART16;
+
+typedef struct {
+    NoART cab;
+    unsigned char indice[256]; // indice[byte] = posição + 1 em filhos (0 = sem filho)
+    void* filhos[48];
+} NoART48;
+
+typedef struct {
+    NoART cab;
+    void* filhos[256];         // Acesso direto pelo byte
+} NoART256;
+
+// Folha: guarda a palavra inteira. Ponteiros para folhas têm o bit mais baixo
+// ligado, o que permite distinguir folha de nó interno sem campo extra.
+typedef struct {
+    uint32_t tamChave;         // Inclui o '\0'
+    unsigned char chave[];
+} FolhaART;
+
+#define EH_FOLHA(p)   (((uintptr_t)(p)) & 1)
+#define PARA_FOLHA(p) ((FolhaART*)(((uintptr_t)(p)) & ~(uintptr_t)1))
+#define DE_FOLHA(f)   ((void*)(((uintptr_t)(f)) | 1))
+
+// Auxiliar: aloca um nó interno do tipo pedido, zerado
+NoART* criarNoART(uint8_t tipo) {
+    size_t tamanho = (tipo == ART_NO4) ? sizeof(NoART4) :
+                     (tipo == ART_NO16) ? sizeof(NoART16) :
+                     (tipo == ART_NO48) ? sizeof(NoART48) : sizeof(NoART256);
+    NoART* novo = (NoART*)calloc(1, tamanho);
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    novo->tipo = tipo;
+    return novo;
+}
+
+// Auxiliar: cria uma folha com a palavra (incluindo o '\0')
+void* criarFolhaART(const unsigned char* chave, uint32_t tam) {
+    FolhaART* folha = (FolhaART*)malloc(sizeof(FolhaART) + tam);
+    if (folha == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    folha->tamChave = tam;
+    memcpy(folha->chave, chave, tam);
+    return DE_FOLHA(folha);
+}
+
+// Auxiliar: endereço do ponteiro do filho para o byte c (NULL se não existe)
+void** encontrarFilhoART(NoART* no, unsigned char c) {
+    switch (no->tipo) {
+        case ART_NO4: {
+            NoART4* n = (NoART4*)no;
+            for (int i = 0; i < no->qtdFilhos; i++) {
+                if (n->chaves[i] == c) return &n->filhos[i];
+            }
+            return NULL;
+        }
+        case ART_NO16: {
+            NoART16* n = (NoART16*)no;
+#ifdef __SSE2__
+            // Compara os 16 bytes de chave de uma vez e pega a posição do acerto
+            __m128i alvo = _mm_set1_epi8((char)c);
+            __m128i chaves = _mm_loadu_si128((__m128i*)n->chaves);
+            int bits = _mm_movemask_epi8(_mm_cmpeq_epi8(alvo, chaves)) & ((1 << no->qtdFilhos) - 1);
+            if (bits) return &n->filhos[__builtin_ctz(bits)];
+#else
+            for (int i = 0; i < no->qtdFilhos; i++) {
+                if (n->chaves[i] == c) return &n->filhos[i];
+            }
+#endif
+            return NULL;
+        }
+        case ART_NO48: {
+            NoART48* n = (NoART48*)no;
+            return n->indice[c] ? &n->filhos[n->indice[c] - 1] : NULL;
+        }
+        default: {
+            NoART256* n = (NoART256*)no;
+            return n->filhos[c] ? &n->filhos[c] : NULL;
+        }
+    }
+}
+
+// Auxiliar: folha de menor chave da subárvore (usada para recuperar prefixos longos)
+FolhaART* folhaMinimaART(void* p) {
+    while (!EH_FOLHA(p)) {
+        NoART* no = (NoART*)p;
+        switch (no->tipo) {
+            case ART_NO4:  p = ((NoART4*)no)->filhos[0]; break;
+            case ART_NO16: p = ((NoART16*)no)->filhos[0]; break;
+            case ART_NO48: {
+                NoART48* n = (NoART48*)no;
+                int c = 0;
+                while (!n->indice[c]) c++;
+                p = n->filhos[n->indice[c] - 1];
+                break;
+            }
+            default: {
+                NoART256* n = (NoART256*)no;
+                int c = 0;
+                while (!n->filhos[c]) c++;
+                p = n->filhos[c];
+                break;
+            }
+        }
+    }
+    return PARA_FOLHA(p);
+}
+
+// Auxiliar: quantos bytes do prefixo do nó batem com a chave a partir de 'prof'
+uint32_t diferencaPrefixoART(NoART* no, const unsigned char* chave, uint32_t tam, uint32_t prof) {
+    uint32_t limite = no->tamPrefixo < MAX_PREFIXO_ART ? no->tamPrefixo : MAX_PREFIXO_ART;
+    uint32_t i = 0;
+    for (; i < limite && prof + i < tam; i++) {
+        if (no->prefixo[i] != chave[prof + i]) return i;
+    }
+    // Prefixo maior que o guardado: o restante é lido da folha mínima
+    if (i == limite && no->tamPrefixo > MAX_PREFIXO_ART) {
+        FolhaART* folha = folhaMinimaART(no);
+        for (; i < no->tamPrefixo && prof + i < tam; i++) {
+            if (folha->chave[prof + i] != chave[prof + i]) return i;
+        }
+    }
+    return i;
+}
+
+// Auxiliar: adiciona o filho 'filho' no byte c, trocando o nó por um maior se estiver cheio.
+// 'ref' é o ponteiro (no pai) que aponta para o nó, atualizado quando o nó cresce.
+void adicionarFilhoART(void** ref, NoART* no, unsigned char c, void* filho) {
+    switch (no->tipo) {
+        case ART_NO4: {
+            NoART4* n = (NoART4*)no;
+            if (no->qtdFilhos < 4) {
+                int pos = 0;
+                while (pos < no->qtdFilhos && n->chaves[pos] < c) pos++;
+                memmove(n->chaves + pos + 1, n->chaves + pos, no->qtdFilhos - pos);
+                memmove(n->filhos + pos + 1, n->filhos + pos, (no->qtdFilhos - pos) * sizeof(void*));
+                n->chaves[pos] = c;
+                n->filhos[pos] = filho;
+                no->qtdFilhos++;
+                return;
+            }
+            // Cresce para Node16
+            NoART16* maior = (NoART16*)criarNoART(ART_NO16);
+            memcpy(&maior->cab, no, sizeof(NoART));
+            maior->cab.tipo = ART_NO16;
+            memcpy(maior->chaves, n->chaves, 4);
+            memcpy(maior->filhos, n->filhos, 4 * sizeof(void*));
+            *ref = maior;
+            free(no);
+            adicionarFilhoART(ref, (NoART*)maior, c, filho);
+            return;
+        }
+        case ART_NO16: {
+            NoART16* n = (NoART16*)no;
+            if (no->qtdFilhos < 16) {
+                int pos = 0;
+                while (pos < no->qtdFilhos && n->chaves[pos] < c) pos++;
+                memmove(n->chaves + pos + 1, n->chaves + pos, no->qtdFilhos - pos);
+                memmove(n->filhos + pos + 1, n->filhos + pos, (no->qtdFilhos - pos) * sizeof(void*));
+                n->chaves[pos] = c;
+                n->filhos[pos] = filho;
+                no->qtdFilhos++;
+                return;
+            }
+            // Cresce para Node48
+            NoART48* maior = (NoART48*)criarNoART(ART_NO48);
+            memcpy(&maior->cab, no, sizeof(NoART));
+            maior->cab.tipo = ART_NO48;
+            for (int i = 0; i < 16; i++) {
+                maior->filhos[i] = n->filhos[i];
+                maior->indice[n->chaves[i]] = (unsigned char)(i + 1);
+            }
+            *ref = maior;
+            free(no);
+            adicionarFilhoART(ref, (NoART*)maior, c, filho);
+            return;
+        }
+        case ART_NO48: {
+            NoART48* n = (NoART48*)no;
+            if (no->qtdFilhos < 48) {
+                // Sem remoção, as posições ocupadas são sempre 0 .. qtdFilhos - 1
+                n->filhos[no->qtdFilhos] = filho;
+                n->indice[c] = (unsigned char)(no->qtdFilhos + 1);
+                no->qtdFilhos++;
+                return;
+            }
+            // Cresce para Node256
+            NoART256* maior = (NoART256*)criarNoART(ART_NO256);
+            memcpy(&maior->cab, no, sizeof(NoART));
+            maior->cab.tipo = ART_NO256;
+            for (int b = 0; b < 256; b++) {
+                if (n->indice[b]) maior->filhos[b] = n->filhos[n->indice[b] - 1];
+            }
+            *ref = maior;
+            free(no);
+            adicionarFilhoART(ref, (NoART*)maior, c, filho);
+            return;
+        }
+        default: {
+            NoART256* n = (NoART256*)no;
+            n->filhos[c] = filho;
+            no->qtdFilhos++;
+            return;
+        }
+    }
+}
+
+// Auxiliar recursivo da inserção
+void inserirARTRecursivo(void** ref, const unsigned char* chave, uint32_t tam, uint32_t prof) {
+    void* atual = *ref;
+
+    // Caso base: posição vazia, a palavra inteira vira uma folha
+    if (atual == NULL) {
+        *ref = criarFolhaART(chave, tam);
+        return;
+    }
+
+    // Encontrou uma folha: se for outra palavra, as duas passam a dividir um Node4
+    if (EH_FOLHA(atual)) {
+        FolhaART* folha = PARA_FOLHA(atual);
+        if (folha->tamChave == tam && memcmp(folha->chave, chave, tam) == 0) return; // Já existe
+
+        // Bytes em comum a partir de prof viram o prefixo do novo nó
+        uint32_t comum = 0;
+        while (prof + comum < tam && prof + comum < folha->tamChave &&
+               folha->chave[prof + comum] == chave[prof + comum]) comum++;
+
+        NoART* novo = criarNoART(ART_NO4);
+        novo->tamPrefixo = comum;
+        memcpy(novo->prefixo, chave + prof, comum < MAX_PREFIXO_ART ? comum : MAX_PREFIXO_ART);
+        *ref = novo;
+        adicionarFilhoART(ref, novo, folha->chave[prof + comum], atual);
+        adicionarFilhoART(ref, novo, chave[prof + comum], criarFolhaART(chave, tam));
+        return;
+    }
+
+    NoART* no = (NoART*)atual;
+
+    // Confere o prefixo comprimido; se divergir no meio, divide o caminho
+    if (no->tamPrefixo > 0) {
+        uint32_t dif = diferencaPrefixoART(no, chave, tam, prof);
+        if (dif < no->tamPrefixo) {
+            NoART* novo = criarNoART(ART_NO4);
+            novo->tamPrefixo = dif;
+            memcpy(novo->prefixo, no->prefixo, dif < MAX_PREFIXO_ART ? dif : MAX_PREFIXO_ART);
+            *ref = novo;
+
+            // O nó antigo perde os dif + 1 primeiros bytes do prefixo
+            if (no->tamPrefixo <= MAX_PREFIXO_ART) {
+                unsigned char byte = no->prefixo[dif];
+                no->tamPrefixo -= dif + 1;
+                memmove(no->prefixo, no->prefixo + dif + 1, no->tamPrefixo);
+                adicionarFilhoART(ref, novo, byte, no);
+            } else {
+                // Bytes que não cabem no nó são recuperados da folha mínima
+                FolhaART* folha = folhaMinimaART(no);
+                unsigned char byte = folha->chave[prof + dif];
+                no->tamPrefixo -= dif + 1;
+                memcpy(no->prefixo, folha->chave + prof + dif + 1,
+                       no->tamPrefixo < MAX_PREFIXO_ART ? no->tamPrefixo : MAX_PREFIXO_ART);
+                adicionarFilhoART(ref, novo, byte, no);
+            }
+            adicionarFilhoART(ref, novo, chave[prof + dif], criarFolhaART(chave, tam));
+            return;
+        }
+        prof += no->tamPrefixo;
+    }
+
+    // Desce para o filho do próximo byte ou cria a folha ali mesmo
+    void** filho = encontrarFilhoART(no, chave[prof]);
+    if (filho != NULL) {
+        inserirARTRecursivo(filho, chave, tam, prof + 1);
+    } else {
+        adicionarFilhoART(ref, no, chave[prof], criarFolhaART(chave, tam));
+    }
+}
+
+// Insere uma string na ART (a raiz pode mudar, por isso recebe o endereço dela)
+void inserirART(void** raiz, char* palavra) {
+    inserirARTRecursivo(raiz, (const unsigned char*)palavra, (uint32_t)strlen(palavra) + 1, 0);
+}
+
+// Busca uma string na ART
+bool buscarART(void* raiz, char* palavra) {
+    const unsigned char* chave = (const unsigned char*)palavra;
+    uint32_t tam = (uint32_t)strlen(palavra) + 1;
+    uint32_t prof = 0;
+    void* atual = raiz;
+
+    while (atual != NULL) {
+        // Na folha, a palavra inteira é comparada (confirma também prefixos longos)
+        if (EH_FOLHA(atual)) {
+            FolhaART* folha = PARA_FOLHA(atual);
+            return folha->tamChave == tam && memcmp(folha->chave, chave, tam) == 0;
+        }
+
+        NoART* no = (NoART*)atual;
+        if (no->tamPrefixo > 0) {
+            // Busca otimista: só os bytes guardados no nó são conferidos aqui
+            uint32_t limite = no->tamPrefixo < MAX_PREFIXO_ART ? no->tamPrefixo : MAX_PREFIXO_ART;
+            for (uint32_t i = 0; i < limite; i++) {
+                if (prof + i >= tam || no->prefixo[i] != chave[prof + i]) return false;
+            }
+            prof += no->tamPrefixo;
+        }
+        if (prof >= tam) return false;
+
+        void** filho = encontrarFilhoART(no, chave[prof]);
+        atual = filho ? *filho : NULL;
+        prof++;
+    }
+    return false;
+}
+
+// Percorre a ART em ordem crescente de bytes e imprime as palavras
+void emOrdemART(void* p) {
+    if (p == NULL) return;
+    if (EH_FOLHA(p)) {
+        printf("%s ", (char*)PARA_FOLHA(p)->chave);
+        return;
+    }
+    NoART* no = (NoART*)p;
+    switch (no->tipo) {
+        case ART_NO4:
+            for (int i = 0; i < no->qtdFilhos; i++) emOrdemART(((NoART4*)no)->filhos[i]);
+            break;
+        case ART_NO16:
+            for (int i = 0; i < no->qtdFilhos; i++) emOrdemART(((NoART16*)no)->filhos[i]);
+            break;
+        case ART_NO48: {
+            NoART48* n = (NoART48*)no;
+            for (int b = 0; b < 256; b++) {
+                if (n->indice[b]) emOrdemART(n->filhos[n->indice[b] - 1]);
+            }
+            break;
+        }
+        default:
+            for (int b = 0; b < 256; b++) emOrdemART(((NoART256*)no)->filhos[b]);
+            break;
+    }
+}
+
+// Calcula nós e bytes ocupados pela ART (sem o cabeçalho interno do malloc)
+void medirART(void* p, long* qtdNos, long* bytes) {
+    if (p == NULL) return;
+    (*qtdNos)++;
+    if (EH_FOLHA(p)) {
+        *bytes += sizeof(FolhaART) + PARA_FOLHA(p)->tamChave;
+        return;
+    }
+    NoART* no = (NoART*)p;
+    void** filhos;
+    int qtdPosicoes;
+    switch (no->tipo) {
+        case ART_NO4:  *bytes += sizeof(NoART4);  filhos = ((NoART4*)no)->filhos;  qtdPosicoes = no->qtdFilhos; break;
+        case ART_NO16: *bytes += sizeof(NoART16); filhos = ((NoART16*)no)->filhos; qtdPosicoes = no->qtdFilhos; break;
+        case ART_NO48: *bytes += sizeof(NoART48); filhos = ((NoART48*)no)->filhos; qtdPosicoes = no->qtdFilhos; break;
+        default:       *bytes += sizeof(NoART256); filhos = ((NoART256*)no)->filhos; qtdPosicoes = 256; break;
+    }
+    for (int i = 0; i < qtdPosicoes; i++) medirART(filhos[i], qtdNos, bytes);
+}
+
+// Libera memória da ART (Recursivo)
+void liberarART(void* p) {
+    if (p == NULL) return;
+    if (EH_FOLHA(p)) {
+        free(PARA_FOLHA(p));
+        return;
+    }
+    NoART* no = (NoART*)p;
+    switch (no->tipo) {
+        case ART_NO4:
+            for (int i = 0; i < no->qtdFilhos; i++) liberarART(((NoART4*)no)->filhos[i]);
+            break;
+        case ART_NO16:
+            for (int i = 0; i < no->qtdFilhos; i++) liberarART(((NoART16*)no)->filhos[i]);
+            break;
+        case ART_NO48:
+            for (int i = 0; i < no->qtdFilhos; i++) liberarART(((NoART48*)no)->filhos[i]);
+            break;
+        default:
+            for (int b = 0; b < 256; b++) liberarART(((NoART256*)no)->filhos[b]);
+            break;
+    }
+    free(no);
+}
+
 // ============================================================================
 // MAIN: TESTES E COMPARAÇÃO
 // ============================================================================
 
+// Visitante: imprime todas as palavras
+bool imprimirPalavra(char* palavra, void* contexto) {
+    (void)contexto;
+    printf("%s ", palavra);
+    return true;
+}
+
+// Visitante: imprime até o limite apontado por contexto e então interrompe
+bool imprimirAteLimite(char* palavra, void* contexto) {
+    int* restantes = (int*)contexto;
+    printf("%s ", palavra);
+    return --(*restantes) > 0;
+}
+
 int main() {
     char* palavras[] = {"casa", "carro", "caminhao", "arvore", "dado", "bola"};
     int qtd = 6;
 
     printf("========================================================\n");
-    printf("       ESTRUTURAS DE DADOS: BST vs TRIE\n");
+    printf("       ESTRUTURAS DE DADOS: BST vs TRIE vs ART\n");
     printf("========================================================\n");
     printf("Palavras a inserir: casa, carro, caminhao, arvore, dado, bola\n\n");
 
@@ -220,6 +1096,15 @@ int main() {
     printf("Busca '%s': %s\n", busca1, buscarBST(raizBST, busca1) ? "ENCONTRADO" : "NAO ENCONTRADO");
     printf("Busca '%s': %s\n", busca2, buscarBST(raizBST, busca2) ? "ENCONTRADO" : "NAO ENCONTRADO");
 
+    // Busca em lote: várias palavras avançando intercaladas
+    char* lote[] = {"dado", "bola", "barco", "casa", "caminh"};
+    bool encontrados[5];
+    buscarBSTLote(raizBST, lote, 5, 4, encontrados);
+    printf("Busca em lote:");
+    for (int i = 0; i < 5; i++) printf(" %s=%s", lote[i], encontrados[i] ? "sim" : "nao");
+    printf("\n");
+
+    long bytesBST = contarNosBST(raizBST) * (long)sizeof(NoBST);
     liberarBST(raizBST);
     printf("\n");
 
@@ -236,13 +1121,80 @@ int main() {
     // Teste de Busca Trie
     // Note que a Trie é muito eficiente para verificar prefixos ou palavras exatas
     printf("Busca '%s': %s\n", busca1, buscarTrie(raizTrie, busca1) ? "ENCONTRADO" : "NAO ENCONTRADO");
+    buscarTrieLote(raizTrie, lote, 5, 4, encontrados);
+    printf("Busca em lote:");
+    for (int i = 0; i < 5; i++) printf(" %s=%s", lote[i], encontrados[i] ? "sim" : "nao");
+    printf("\n");
     
     // Teste interessante da Trie: Palavra que existe como prefixo, mas não completa
     char busca3[] = "caminh"; // Prefixo de caminhao
     printf("Busca '%s' (prefixo de caminhao): %s\n", busca3, 
            buscarTrie(raizTrie, busca3) ? "ENCONTRADO" : "NAO ENCONTRADO (Pois nao eh palavra completa)");
 
+    // Busca por prefixo: lista as palavras completas que começam com o texto
+    printf("Palavras com prefixo '%s': ", busca3);
+    listarPrefixoTrie(raizTrie, busca3, imprimirPalavra, NULL);
+    printf("\n");
+
+    int limite = 2; // Interrompe a listagem após 2 palavras
+    char prefixo[] = "ca";
+    printf("Primeiras %d palavras com prefixo '%s': ", limite, prefixo);
+    listarPrefixoTrie(raizTrie, prefixo, imprimirAteLimite, &limite);
+    printf("\n");
+
+    // Busca aproximada: palavras a até 1 edição (troca, inserção ou remoção)
+    char* erradas[] = {"caro", "arvre", "bolas"};
+    for (int i = 0; i < 3; i++) {
+        long visitados = 0;
+        printf("Ate 1 edicao de '%s': ", erradas[i]);
+        buscarAproximadoTrie(raizTrie, erradas[i], 1, imprimirPalavra, NULL, &visitados);
+        printf("(%ld nos visitados)\n", visitados);
+    }
+
+    // Palavras acentuadas (UTF-8) são guardadas byte a byte, sem corromper
+    inserirTrie(raizTrie, busca2);
+    char busca4[] = "aviao";
+    printf("Busca '%s' (apos inserir): %s\n", busca2, buscarTrie(raizTrie, busca2) ? "ENCONTRADO" : "NAO ENCONTRADO");
+    printf("Busca '%s' (sem acento): %s\n", busca4, buscarTrie(raizTrie, busca4) ? "ENCONTRADO" : "NAO ENCONTRADO");
+
+    long qtdNos = 0, bytes = 0;
+    medirTrie(raizTrie, &qtdNos, &bytes);
+    printf("Memoria da Trie: %ld nos, %ld bytes (com 256 ponteiros fixos seriam %ld bytes)\n",
+           qtdNos, bytes, qtdNos * (long)(TAM_ALFABETO * sizeof(NoTrie*) + sizeof(bool)));
+
     liberarTrie(raizTrie);
+    printf("\n");
+
+    // ------------------------------------------------------------
+    // TESTE 3: ART
+    // ------------------------------------------------------------
+    printf("--- [3] Testando ART (Adaptive Radix Tree) ---\n");
+    void* raizART = NULL;
+
+    for(int i = 0; i < qtd; i++) {
+        inserirART(&raizART, palavras[i]);
+    }
+
+    printf("Percurso Em Ordem (Ordenado): ");
+    emOrdemART(raizART);
+    printf("\n");
+
+    printf("Busca '%s': %s\n", busca1, buscarART(raizART, busca1) ? "ENCONTRADO" : "NAO ENCONTRADO");
+    printf("Busca '%s': %s\n", busca3, buscarART(raizART, busca3) ? "ENCONTRADO" : "NAO ENCONTRADO");
+    inserirART(&raizART, busca2);
+    printf("Busca '%s' (apos inserir): %s\n", busca2, buscarART(raizART, busca2) ? "ENCONTRADO" : "NAO ENCONTRADO");
+
+    long qtdNosART = 0, bytesART = 0;
+    medirART(raizART, &qtdNosART, &bytesART);
+    liberarART(raizART);
+
+    // ------------------------------------------------------------
+    // COMPARAÇÃO DE MEMÓRIA
+    // ------------------------------------------------------------
+    printf("\n--- Memoria ocupada (sem o cabecalho do malloc) ---\n");
+    printf("BST:  %ld bytes (%d palavras)\n", bytesBST, qtd);
+    printf("Trie: %ld bytes (%d palavras + avião)\n", bytes, qtd);
+    printf("ART:  %ld bytes em %ld nos e folhas (%d palavras + avião)\n", bytesART, qtdNosART, qtd);
     
     printf("\nMemoria liberada. Fim do programa.\n");
     return 0;
@@ -0,0 +1,272 @@
+/*
+ * Objetivo: Medir o ganho de guardar os 8 primeiros bytes da chave em cada nó
+ *           da BST de strings (como o NoBST do BST_TRIE.c e o PistaNode do
+ *           Detective_Quest_Pistas.c).
+ *
+ * Versão A (original): cada nível chama strcmp contra char palavra[50].
+ * Versão B (prefixo):  cada nível compara primeiro um uint64_t guardado no
+ *                      começo do nó, ao lado dos ponteiros. O strcmp só
+ *                      acontece quando os 8 primeiros bytes empatam.
+ *
+ * Dois dicionários são medidos:
+ *   1. Palavras variadas (sílabas aleatórias): os prefixos quase sempre decidem.
+ *   2. Chaves com prefixo longo comum ("pista_numero_..."): pior caso, o
+ *      prefixo empata e o strcmp volta a ser usado.
+ *
+ * Uso: ./Benchmark_BST_Prefixo [arquivo_de_palavras.txt]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#define TAM_PALAVRA 50 // Mesmo tamanho do NoBST
+
+// ============================================================================
+// VERSÃO A: BST ORIGINAL
+// ============================================================================
+
+typedef struct NoBST {
+    char palavra[TAM_PALAVRA];
+    struct NoBST* esquerda;
+    struct NoBST* direita;
+} NoBST;
+
+NoBST* criarNoBST(char* palavra) {
+    NoBST* novo = (NoBST*)malloc(sizeof(NoBST));
+    if (novo) {
+        strcpy(novo->palavra, palavra);
+        novo->esquerda = NULL;
+        novo->direita = NULL;
+    }
+    return novo;
+}
+
+NoBST* inserirBST(NoBST* raiz, char* palavra) {
+    if (raiz == NULL) return criarNoBST(palavra);
+    int cmp = strcmp(palavra, raiz->palavra);
+    if (cmp < 0) raiz->esquerda = inserirBST(raiz->esquerda, palavra);
+    else if (cmp > 0) raiz->direita = inserirBST(raiz->direita, palavra);
+    return raiz;
+}
+
+bool buscarBST(NoBST* raiz, char* palavra) {
+    while (raiz != NULL) {
+        int cmp = strcmp(palavra, raiz->palavra);
+        if (cmp == 0) return true;
+        raiz = (cmp < 0) ? raiz->esquerda : raiz->direita;
+    }
+    return false;
+}
+
+void liberarBST(NoBST* raiz) {
+    if (raiz != NULL) {
+        liberarBST(raiz->esquerda);
+        liberarBST(raiz->direita);
+        free(raiz);
+    }
+}
+
+// ============================================================================
+// VERSÃO B: BST COM PREFIXO EM CACHE
+// ============================================================================
+
+typedef struct NoBSTPrefixo {
+    uint64_t prefixo;                // 8 primeiros bytes (big-endian)
+    struct NoBSTPrefixo* esquerda;
+    struct NoBSTPrefixo* direita;
+    char palavra[TAM_PALAVRA];
+} NoBSTPrefixo;
+
+uint64_t prefixoChave(const char* palavra) {
+    uint64_t valor = 0;
+    int i = 0;
+    for (; i < 8 && palavra[i] != '\0'; i++) valor = (valor << 8) | (unsigned char)palavra[i];
+    for (; i < 8; i++) valor <<= 8;
+    return valor;
+}
+
+int compararChave(const char* palavra, uint64_t prefixo, NoBSTPrefixo* no) {
+    if (prefixo != no->prefixo) return (prefixo < no->prefixo) ? -1 : 1;
+    if ((prefixo & 0xFF) == 0) return 0;
+    return strcmp(palavra + 8, no->palavra + 8);
+}
+
+NoBSTPrefixo* criarNoBSTPrefixo(char* palavra, uint64_t prefixo) {
+    NoBSTPrefixo* novo = (NoBSTPrefixo*)malloc(sizeof(NoBSTPrefixo));
+    if (novo) {
+        strcpy(novo->palavra, palavra);
+        novo->prefixo = prefixo;
+        novo->esquerda = NULL;
+        novo->direita = NULL;
+    }
+    return novo;
+}
+
+NoBSTPrefixo* inserirBSTPrefixo(NoBSTPrefixo* raiz, char* palavra, uint64_t prefixo) {
+    if (raiz == NULL) return criarNoBSTPrefixo(palavra, prefixo);
+    int cmp = compararChave(palavra, prefixo, raiz);
+    if (cmp < 0) raiz->esquerda = inserirBSTPrefixo(raiz->esquerda, palavra, prefixo);
+    else if (cmp > 0) raiz->direita = inserirBSTPrefixo(raiz->direita, palavra, prefixo);
+    return raiz;
+}
+
+bool buscarBSTPrefixo(NoBSTPrefixo* raiz, char* palavra) {
+    uint64_t prefixo = prefixoChave(palavra);
+    while (raiz != NULL) {
+        int cmp = compararChave(palavra, prefixo, raiz);
+        if (cmp == 0) return true;
+        raiz = (cmp < 0) ? raiz->esquerda : raiz->direita;
+    }
+    return false;
+}
+
+void liberarBSTPrefixo(NoBSTPrefixo* raiz) {
+    if (raiz != NULL) {
+        liberarBSTPrefixo(raiz->esquerda);
+        liberarBSTPrefixo(raiz->direita);
+        free(raiz);
+    }
+}
+
+// ============================================================================
+// DICIONÁRIOS E MEDIÇÃO
+// ============================================================================
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+// Palavras de 2 a 6 sílabas
+void gerarVariadas(char** palavras, int qtd) {
+    const char* silabas[] = {
+        "ca", "sa", "ro", "mi", "nha", "de", "to", "pe", "li", "ra",
+        "bo", "ma", "te", "co", "la", "ve", "ne", "di", "so", "pa",
+        "men", "tra", "gu", "fi", "cao", "ar", "es", "in", "con", "por"
+    };
+    for (int i = 0; i < qtd; i++) {
+        char palavra[TAM_PALAVRA] = "";
+        int partes = 2 + rand() % 5;
+        for (int p = 0; p < partes; p++) strcat(palavra, silabas[rand() % 30]);
+        strcpy(palavras[i], palavra);
+    }
+}
+
+// Chaves que só diferem depois do 13º byte
+void gerarPrefixoComum(char** palavras, int qtd) {
+    for (int i = 0; i < qtd; i++) {
+        sprintf(palavras[i], "pista_numero_%09d", aleatorio() % 1000000000);
+    }
+}
+
+// Lê uma palavra por linha. Retorna a quantidade lida (até 'maximo').
+int carregarPalavras(const char* caminho, char** palavras, int maximo) {
+    FILE* arquivo = fopen(caminho, "r");
+    if (arquivo == NULL) return 0;
+    char linha[256];
+    int qtd = 0;
+    while (qtd < maximo && fgets(linha, sizeof(linha), arquivo)) {
+        if (strchr(linha, '\n') == NULL && !feof(arquivo)) {
+            int c;
+            while ((c = fgetc(arquivo)) != '\n' && c != EOF); // Descarta o resto da linha longa
+            continue;
+        }
+        linha[strcspn(linha, "\r\n")] = '\0';
+        if (linha[0] == '\0' || strlen(linha) >= TAM_PALAVRA) continue;
+        strcpy(palavras[qtd++], linha);
+    }
+    fclose(arquivo);
+    return qtd;
+}
+
+// Embaralha (Fisher-Yates) para a BST não degenerar em lista
+void embaralhar(char** palavras, int qtd) {
+    for (int i = qtd - 1; i > 0; i--) {
+        int j = aleatorio() % (i + 1);
+        char* temp = palavras[i];
+        palavras[i] = palavras[j];
+        palavras[j] = temp;
+    }
+}
+
+void medir(const char* titulo, char** palavras, int qtd) {
+    printf("\n--- %s (%d chaves) ---\n", titulo, qtd);
+
+    // Consultas: metade existentes, metade ausentes (palavra + "x")
+    char** consultas = (char**)malloc(qtd * sizeof(char*));
+    for (int i = 0; i < qtd; i++) {
+        consultas[i] = (char*)malloc(TAM_PALAVRA + 2);
+        strcpy(consultas[i], palavras[aleatorio() % qtd]);
+        if (i % 2) strcat(consultas[i], "x");
+    }
+
+    clock_t inicio = clock();
+    NoBST* a = NULL;
+    for (int i = 0; i < qtd; i++) a = inserirBST(a, palavras[i]);
+    clock_t fim = clock();
+    double insercaoA = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    NoBSTPrefixo* b = NULL;
+    for (int i = 0; i < qtd; i++) b = inserirBSTPrefixo(b, palavras[i], prefixoChave(palavras[i]));
+    fim = clock();
+    double insercaoB = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    long acertosA = 0, acertosB = 0;
+    inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosA += buscarBST(a, consultas[i]);
+    fim = clock();
+    double buscaA = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosB += buscarBSTPrefixo(b, consultas[i]);
+    fim = clock();
+    double buscaB = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    printf("%-18s %14s %14s\n", "", "strcmp", "prefixo u64");
+    printf("%-18s %14.3f %14.3f\n", "Insercao (s)", insercaoA, insercaoB);
+    printf("%-18s %14.3f %14.3f\n", "Buscas (s)", buscaA, buscaB);
+    printf("%-18s %14.1f %14.1f\n", "ns por busca", buscaA * 1e9 / qtd, buscaB * 1e9 / qtd);
+    printf("Resultados %s (%ld encontradas)\n", acertosA == acertosB ? "CONFEREM" : "DIVERGEM (ERRO!)", acertosA);
+
+    liberarBST(a);
+    liberarBSTPrefixo(b);
+    for (int i = 0; i < qtd; i++) free(consultas[i]);
+    free(consultas);
+}
+
+int main(int argc, char* argv[]) {
+    int qtd = 1000000;
+    char** palavras = (char**)malloc(qtd * sizeof(char*));
+    for (int i = 0; i < qtd; i++) palavras[i] = (char*)malloc(TAM_PALAVRA);
+
+    printf("========================================================\n");
+    printf("       BST DE STRINGS: strcmp vs PREFIXO EM CACHE\n");
+    printf("========================================================\n");
+
+    srand(42);
+    if (argc > 1) {
+        int lidas = carregarPalavras(argv[1], palavras, qtd);
+        if (lidas > 0) {
+            embaralhar(palavras, lidas);
+            medir(argv[1], palavras, lidas);
+        } else {
+            printf("Não foi possível ler '%s'.\n", argv[1]);
+        }
+    }
+
+    gerarVariadas(palavras, qtd);
+    medir("Palavras variadas", palavras, qtd);
+
+    gerarPrefixoComum(palavras, qtd);
+    medir("Prefixo comum de 13 bytes", palavras, qtd);
+
+    for (int i = 0; i < qtd; i++) free(palavras[i]);
+    free(palavras);
+    printf("\nFim do programa.\n");
+    return 0;
+}
@@ -0,0 +1,498 @@
+/*
+ * Objetivo: Medir as buscas em lote com PREFETCH (buscarBSTLote e
+ *           buscarTrieLote do BST_TRIE.c) contra as buscas uma a uma.
+ *
+ * Cada busca na BST ou na Trie é uma cadeia de leituras dependentes: só dá
+ * para saber o próximo nó depois que o atual chega da memória. Com um
+ * dicionário maior que o cache, quase todo o tempo é espera. As versões em
+ * lote intercalam 'tamGrupo' buscas independentes para que essas esperas se
+ * sobreponham.
+ *
+ * A execução varia o tamanho do grupo (1, 2, 4, ..., 64) e mostra o tempo
+ * por busca de cada estrutura. Grupo 1 mede só o custo extra da intercalação.
+ *
+ * Uso: ./Benchmark_Busca_Lote [qtd_palavras]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+
+// Pede ao processador para trazer o endereço para o cache sem esperar por ele
+#if defined(__GNUC__)
+#define PREFETCH(p) __builtin_prefetch(p)
+#else
+#define PREFETCH(p) ((void)0)
+#endif
+
+#define MAX_GRUPO 64 // Máximo de buscas intercaladas nas buscas em lote
+
+// ============================================================================
+// ESTRUTURA 1: ÁRVORE BINÁRIA DE BUSCA (BST)
+// Lógica: Cada nó tem até 2 filhos. Menores à esquerda, maiores à direita.
+// ============================================================================
+
+typedef struct NoBST {
+    uint64_t prefixo;       // 8 primeiros bytes da palavra (big-endian), comparados antes do strcmp
+    struct NoBST* esquerda; // Ponteiro para subárvore com valores menores
+    struct NoBST* direita;  // Ponteiro para subárvore com valores maiores
+    char palavra[50];       // Dado armazenado (string)
+} NoBST;
+
+// Auxiliar: 8 primeiros bytes da palavra como inteiro big-endian (completa com zeros).
+// Comparar dois desses inteiros dá o mesmo resultado que strcmp nos 8 primeiros bytes.
+uint64_t prefixoChave(const char* palavra) {
+    uint64_t valor = 0;
+    int i = 0;
+    for (; i < 8 && palavra[i] != '\0'; i++) valor = (valor << 8) | (unsigned char)palavra[i];
+    for (; i < 8; i++) valor <<= 8;
+    return valor;
+}
+
+// Auxiliar: compara como strcmp, mas decide pelo prefixo sempre que possível.
+// Só lê o restante das strings quando os 8 primeiros bytes empatam.
+int compararChave(const char* palavra, uint64_t prefixo, NoBST* no) {
+    if (prefixo != no->prefixo) return (prefixo < no->prefixo) ? -1 : 1;
+    // Prefixos iguais: se o último byte é zero, a palavra acabou dentro dele e as duas são iguais
+    if ((prefixo & 0xFF) == 0) return 0;
+    return strcmp(palavra + 8, no->palavra + 8);
+}
+
+// Cria um novo nó para a BST
+NoBST* criarNoBST(char* palavra) {
+    NoBST* novo = (NoBST*)malloc(sizeof(NoBST));
+    if (novo) {
+        strcpy(novo->palavra, palavra);
+        novo->prefixo = prefixoChave(palavra);
+        novo->esquerda = NULL;
+        novo->direita = NULL;
+    }
+    return novo;
+}
+
+// Auxiliar recursivo da inserção: o prefixo da palavra é calculado uma única vez
+NoBST* inserirBSTComPrefixo(NoBST* raiz, char* palavra, uint64_t prefixo) {
+    // Caso base: encontrou um lugar vazio, insere aqui
+    if (raiz == NULL) return criarNoBST(palavra);
+
+    int cmp = compararChave(palavra, prefixo, raiz);
+
+    if (cmp < 0) {
+        // Se a palavra é "menor" (vem antes no alfabeto), vai para a esquerda
+        raiz->esquerda = inserirBSTComPrefixo(raiz->esquerda, palavra, prefixo);
+    } else if (cmp > 0) {
+        // Se a palavra é "maior", vai para a direita
+        raiz->direita = inserirBSTComPrefixo(raiz->direita, palavra, prefixo);
+    }
+    // Se cmp == 0, a palavra já existe (ignoramos duplicatas neste exemplo)
+    
+    return raiz;
+}
+
+// Insere uma string na BST mantendo a ordem alfabética (mesma ordem do strcmp)
+NoBST* inserirBST(NoBST* raiz, char* palavra) {
+    return inserirBSTComPrefixo(raiz, palavra, prefixoChave(palavra));
+}
+
+// Auxiliar recursivo da busca
+bool buscarBSTComPrefixo(NoBST* raiz, char* palavra, uint64_t prefixo) {
+    if (raiz == NULL) return false; // Chegou ao fim e não achou
+
+    int cmp = compararChave(palavra, prefixo, raiz);
+
+    if (cmp == 0) return true; // Achou!
+    else if (cmp < 0) return buscarBSTComPrefixo(raiz->esquerda, palavra, prefixo); // Busca na esquerda
+    else return buscarBSTComPrefixo(raiz->direita, palavra, prefixo); // Busca na direita
+}
+
+// Busca uma string na BST
+bool buscarBST(NoBST* raiz, char* palavra) {
+    return buscarBSTComPrefixo(raiz, palavra, prefixoChave(palavra));
+}
+
+// --- Busca em Lote na BST ---
+// Uma busca sozinha passa a maior parte do tempo esperando o próximo nó chegar
+// da memória, e só depois sabe qual é o seguinte. Aqui até 'tamGrupo' buscas
+// independentes avançam intercaladas: cada uma dá um passo, pede o seu próximo
+// nó com PREFETCH e cede a vez. Quando ela for atendida de novo, o nó já deve
+// estar no cache, e as esperas de buscas diferentes se sobrepõem.
+// encontrados[i] recebe o resultado de palavras[i].
+void buscarBSTLote(NoBST* raiz, char** palavras, int qtd, int tamGrupo, bool* encontrados) {
+    NoBST* atual[MAX_GRUPO];
+    uint64_t prefixo[MAX_GRUPO];
+    int consulta[MAX_GRUPO]; // Índice da palavra em cada posição do grupo (-1 = livre)
+    if (tamGrupo < 1) tamGrupo = 1;
+    if (tamGrupo > MAX_GRUPO) tamGrupo = MAX_GRUPO;
+
+    int proxima = 0, ativas = 0;
+    for (int g = 0; g < tamGrupo; g++) {
+        consulta[g] = -1;
+        if (proxima < qtd) {
+            consulta[g] = proxima;
+            prefixo[g] = prefixoChave(palavras[proxima]);
+            atual[g] = raiz;
+            proxima++;
+            ativas++;
+        }
+    }
+    PREFETCH(raiz);
+
+    while (ativas > 0) {
+        for (int g = 0; g < tamGrupo; g++) {
+            int c = consulta[g];
+            if (c < 0) continue;
+
+            NoBST* no = atual[g];
+            if (no != NULL) {
+                int cmp = compararChave(palavras[c], prefixo[g], no);
+                if (cmp != 0) {
+                    // Ainda não terminou: desce um nível e pede o próximo nó
+                    atual[g] = (cmp < 0) ? no->esquerda : no->direita;
+                    PREFETCH(atual[g]);
+                    continue;
+                }
+            }
+            // Terminou (achou ou chegou a NULL): a posição recebe a próxima palavra
+            encontrados[c] = (no != NULL);
+            if (proxima < qtd) {
+                consulta[g] = proxima;
+                prefixo[g] = prefixoChave(palavras[proxima]);
+                atual[g] = raiz;
+                proxima++;
+            } else {
+                consulta[g] = -1;
+                ativas--;
+            }
+        }
+    }
+}
+
+
+// Libera memória da BST
+void liberarBST(NoBST* raiz) {
+    if (raiz != NULL) {
+        liberarBST(raiz->esquerda);
+        liberarBST(raiz->direita);
+        free(raiz);
+    }
+}
+
+// ============================================================================
+// ESTRUTURA 2: TRIE (ÁRVORE DE PREFIXOS)
+// Lógica: Cada nó representa um byte. O caminho da raiz até um nó forma a palavra.
+// Aceita qualquer byte, então palavras em UTF-8 ("avião") são guardadas como
+// a sequência de bytes de cada caractere.
+// ============================================================================
+
+#define TAM_ALFABETO 256 // Um filho possível para cada valor de byte
+
+typedef struct NoTrie {
+    uint64_t mapa[4];         // 256 bits: bit b ligado = existe filho para o byte b
+    struct NoTrie** filhos;   // Somente os filhos que existem, em ordem crescente de byte
+    unsigned short qtdFilhos; // Tamanho do vetor filhos
+    bool fimDaPalavra;        // Marca se este nó encerra uma palavra válida
+} NoTrie;
+
+// Com 256 ponteiros fixos cada nó teria mais de 2 KB. Aqui o nó tem
+// 32 bytes de mapa + um ponteiro por filho existente.
+
+// Auxiliar: quantidade de bits ligados em uma palavra de 64 bits
+int contarBits(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int total = 0;
+    while (x) { x &= x - 1; total++; }
+    return total;
+#endif
+}
+
+// Auxiliar: índice do bit ligado mais baixo (x != 0)
+int indiceMenorBit(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int i = 0;
+    while (!(x & 1)) { x >>= 1; i++; }
+    return i;
+#endif
+}
+
+// Auxiliar: posição do filho do byte b no vetor denso.
+// É o número de filhos com byte menor que b (bits ligados antes de b no mapa).
+int posicaoFilho(NoTrie* no, int b) {
+    int palavra = b >> 6;
+    uint64_t antes = no->mapa[palavra] & ((1ULL << (b & 63)) - 1);
+    int pos = contarBits(antes);
+    for (int i = 0; i < palavra; i++) pos += contarBits(no->mapa[i]);
+    return pos;
+}
+
+// Auxiliar: retorna o filho do byte b ou NULL
+NoTrie* obterFilho(NoTrie* no, int b) {
+    if (!(no->mapa[b >> 6] & (1ULL << (b & 63)))) return NULL;
+    return no->filhos[posicaoFilho(no, b)];
+}
+
+// Cria um novo nó para a Trie
+NoTrie* criarNoTrie() {
+    NoTrie* novo = (NoTrie*)malloc(sizeof(NoTrie));
+    if (novo) {
+        novo->fimDaPalavra = false;
+        for (int i = 0; i < 4; i++) {
+            novo->mapa[i] = 0; // Nenhum filho ainda
+        }
+        novo->filhos = NULL;
+        novo->qtdFilhos = 0;
+    }
+    return novo;
+}
+
+// Auxiliar: cria o filho do byte b mantendo o vetor denso ordenado
+NoTrie* adicionarFilho(NoTrie* no, int b) {
+    NoTrie* filho = criarNoTrie();
+    NoTrie** novos = (NoTrie**)realloc(no->filhos, (no->qtdFilhos + 1) * sizeof(NoTrie*));
+    if (filho == NULL || novos == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    int pos = posicaoFilho(no, b);
+    // Abre espaço deslocando os filhos de byte maior uma posição para a direita
+    memmove(&novos[pos + 1], &novos[pos], (no->qtdFilhos - pos) * sizeof(NoTrie*));
+    novos[pos] = filho;
+    no->filhos = novos;
+    no->qtdFilhos++;
+    no->mapa[b >> 6] |= 1ULL << (b & 63);
+    return filho;
+}
+
+// Auxiliar: Converte char para índice (0 a 255).
+// Letras ASCII viram minúsculas; os demais bytes (inclusive UTF-8) são mantidos.
+int charParaIndice(char c) {
+    unsigned char b = (unsigned char)c;
+    if (b < 128) return tolower(b);
+    return b;
+}
+
+// Insere uma palavra na Trie
+void inserirTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+
+        // Se não existe o caminho para esse byte, cria
+        NoTrie* proximo = obterFilho(atual, indice);
+        if (proximo == NULL) {
+            proximo = adicionarFilho(atual, indice);
+        }
+        // Avança para o próximo nó
+        atual = proximo;
+    }
+    // Marca o último nó como fim de uma palavra completa
+    atual->fimDaPalavra = true;
+}
+
+// Busca uma palavra exata na Trie
+bool buscarTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        // Se o caminho for interrompido (NULL), a palavra não existe
+        atual = obterFilho(atual, charParaIndice(palavra[i]));
+        if (atual == NULL) {
+            return false;
+        }
+    }
+    // Retorna true apenas se chegamos ao final E estiver marcado como fim de palavra
+    return (atual != NULL && atual->fimDaPalavra);
+}
+
+// --- Busca em Lote na Trie ---
+// Mesma ideia do buscarBSTLote. Na Trie cada nível tem duas leituras
+// dependentes: o nó (mapa) e depois o vetor de filhos, que é outra alocação.
+// Por isso cada busca alterna entre duas etapas, e cada etapa termina pedindo
+// com PREFETCH o endereço que a próxima etapa vai ler.
+void buscarTrieLote(NoTrie* raiz, char** palavras, int qtd, int tamGrupo, bool* encontrados) {
+    NoTrie* atual[MAX_GRUPO];
+    int posicao[MAX_GRUPO];  // Posição do filho no vetor denso (-1 = ainda falta ler o mapa)
+    int letra[MAX_GRUPO];    // Próximo byte da palavra a consumir
+    int consulta[MAX_GRUPO]; // Índice da palavra em cada posição do grupo (-1 = livre)
+    if (tamGrupo < 1) tamGrupo = 1;
+    if (tamGrupo > MAX_GRUPO) tamGrupo = MAX_GRUPO;
+
+    int proxima = 0, ativas = 0;
+    for (int g = 0; g < tamGrupo; g++) {
+        consulta[g] = -1;
+        if (proxima < qtd) {
+            consulta[g] = proxima++;
+            atual[g] = raiz;
+            posicao[g] = -1;
+            letra[g] = 0;
+            ativas++;
+        }
+    }
+
+    while (ativas > 0) {
+        for (int g = 0; g < tamGrupo; g++) {
+            int c = consulta[g];
+            if (c < 0) continue;
+
+            NoTrie* no = atual[g];
+            if (posicao[g] >= 0) {
+                // Etapa 2: o vetor de filhos já foi pedido; desce e pede o filho
+                atual[g] = no->filhos[posicao[g]];
+                posicao[g] = -1;
+                letra[g]++;
+                PREFETCH(atual[g]);
+                continue;
+            }
+
+            // Etapa 1: lê o mapa do nó
+            char ch = palavras[c][letra[g]];
+            bool terminou, achou = false;
+            if (ch == '\0') {
+                terminou = true;
+                achou = no->fimDaPalavra;
+            } else {
+                int b = charParaIndice(ch);
+                terminou = !(no->mapa[b >> 6] & (1ULL << (b & 63)));
+                if (!terminou) {
+                    posicao[g] = posicaoFilho(no, b);
+                    PREFETCH(&no->filhos[posicao[g]]);
+                }
+            }
+            if (!terminou) continue;
+
+            encontrados[c] = achou;
+            if (proxima < qtd) {
+                consulta[g] = proxima++;
+                atual[g] = raiz;
+                letra[g] = 0;
+            } else {
+                consulta[g] = -1;
+                ativas--;
+            }
+        }
+    }
+}
+
+
+// Libera memória da Trie (Recursivo)
+void liberarTrie(NoTrie* raiz) {
+    if (raiz == NULL) return;
+    for (int i = 0; i < raiz->qtdFilhos; i++) {
+        liberarTrie(raiz->filhos[i]);
+    }
+    free(raiz->filhos);
+    free(raiz);
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+// Palavras de 2 a 6 sílabas
+void gerarPalavra(char* destino) {
+    const char* silabas[] = {
+        "ca", "sa", "ro", "mi", "nha", "de", "to", "pe", "li", "ra",
+        "bo", "ma", "te", "co", "la", "ve", "ne", "di", "so", "pa",
+        "men", "tra", "gu", "fi", "cao", "ar", "es", "in", "con", "por"
+    };
+    destino[0] = '\0';
+    int partes = 2 + rand() % 5;
+    for (int p = 0; p < partes; p++) strcat(destino, silabas[rand() % 30]);
+}
+
+double agoraSegundos() {
+    struct timespec t;
+    timespec_get(&t, TIME_UTC);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    int qtd = 1000000;
+    if (argc > 1 && atoi(argv[1]) > 0) qtd = atoi(argv[1]);
+    int qtdConsultas = 2000000;
+
+    char** palavras = (char**)malloc(qtd * sizeof(char*));
+    char** consultas = (char**)malloc(qtdConsultas * sizeof(char*));
+    bool* esperado = (bool*)malloc(qtdConsultas * sizeof(bool));
+    bool* obtido = (bool*)malloc(qtdConsultas * sizeof(bool));
+    if (palavras == NULL || consultas == NULL || esperado == NULL || obtido == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+
+    printf("========================================================\n");
+    printf("     BUSCAS EM LOTE COM PREFETCH: BST e TRIE\n");
+    printf("========================================================\n");
+
+    srand(42);
+    NoBST* raizBST = NULL;
+    NoTrie* raizTrie = criarNoTrie();
+    for (int i = 0; i < qtd; i++) {
+        palavras[i] = (char*)malloc(40);
+        gerarPalavra(palavras[i]);
+        raizBST = inserirBST(raizBST, palavras[i]);
+        inserirTrie(raizTrie, palavras[i]);
+    }
+    // Consultas em ordem aleatória: metade existentes, metade com uma letra a mais
+    for (int i = 0; i < qtdConsultas; i++) {
+        consultas[i] = (char*)malloc(42);
+        strcpy(consultas[i], palavras[aleatorio() % qtd]);
+        if (i % 2) strcat(consultas[i], "x");
+    }
+    printf("Dicionario: %d palavras | Consultas: %d\n\n", qtd, qtdConsultas);
+
+    // Referência: uma busca de cada vez
+    double inicio = agoraSegundos();
+    for (int i = 0; i < qtdConsultas; i++) esperado[i] = buscarBST(raizBST, consultas[i]);
+    double umaBST = (agoraSegundos() - inicio) * 1e9 / qtdConsultas;
+
+    inicio = agoraSegundos();
+    long divergenciasTrie = 0;
+    for (int i = 0; i < qtdConsultas; i++) divergenciasTrie += (buscarTrie(raizTrie, consultas[i]) != esperado[i]);
+    double umaTrie = (agoraSegundos() - inicio) * 1e9 / qtdConsultas;
+
+    printf("%-22s %15s %15s\n", "", "BST (ns/busca)", "Trie (ns/busca)");
+    printf("%-22s %15.1f %15.1f\n", "Uma a uma", umaBST, umaTrie);
+
+    long divergencias = divergenciasTrie;
+    for (int grupo = 1; grupo <= MAX_GRUPO; grupo *= 2) {
+        inicio = agoraSegundos();
+        buscarBSTLote(raizBST, consultas, qtdConsultas, grupo, obtido);
+        double loteBST = (agoraSegundos() - inicio) * 1e9 / qtdConsultas;
+        for (int i = 0; i < qtdConsultas; i++) divergencias += (obtido[i] != esperado[i]);
+
+        inicio = agoraSegundos();
+        buscarTrieLote(raizTrie, consultas, qtdConsultas, grupo, obtido);
+        double loteTrie = (agoraSegundos() - inicio) * 1e9 / qtdConsultas;
+        for (int i = 0; i < qtdConsultas; i++) divergencias += (obtido[i] != esperado[i]);
+
+        char titulo[32];
+        sprintf(titulo, "Lote, grupo de %d", grupo);
+        printf("%-22s %15.1f %15.1f\n", titulo, loteBST, loteTrie);
+    }
+    printf("\nResultados %s\n", divergencias == 0 ? "CONFEREM em todas as versoes" : "DIVERGEM (ERRO!)");
+
+    liberarBST(raizBST);
+    liberarTrie(raizTrie);
+    for (int i = 0; i < qtd; i++) free(palavras[i]);
+    for (int i = 0; i < qtdConsultas; i++) free(consultas[i]);
+    free(palavras);
+    free(consultas);
+    free(esperado);
+    free(obtido);
+    printf("\nFim do programa.\n");
+    return 0;
+}
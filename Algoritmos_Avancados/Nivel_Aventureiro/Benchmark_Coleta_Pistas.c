@@ -0,0 +1,501 @@
+/*
+ * Objetivo: Comparar as duas formas de guardar as pistas coletadas no
+ *           Detective_Quest_Pistas.c em sessões longas de exploração.
+ *
+ * Versão A (BST): inserirPista a cada visita. Cada visita desce a árvore
+ *                 comparando textos e a primeira visita de cada pista faz malloc.
+ * Versão B (adiada): registrarPista a cada visita descarta a sala já vista
+ *                 pelo endereço da pista e guarda um ponteiro no fim de um
+ *                 vetor; consolidarColeta ordena e remove textos repetidos
+ *                 uma única vez, na hora do relatório.
+ * Versão C (digitais): BST com o conjunto de digitais na frente; só a
+ *                 primeira visita de cada pista desce a árvore.
+ *
+ * A mansão é gerada com muitas salas e as sessões são caminhadas aleatórias
+ * da entrada até um beco sem saída, repetidas até o total de visitas.
+ *
+ * Uso: ./Benchmark_Coleta_Pistas [visitas]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+// ============================================================================
+// ESTRUTURAS (iguais ao Detective_Quest_Pistas.c)
+// ============================================================================
+
+// Estrutura para a Árvore de Pistas (BST)
+// Armazena o texto da pista e ponteiros para ordenação.
+typedef struct PistaNode {
+    uint64_t prefixo;              // 8 primeiros bytes do conteúdo (big-endian), comparados antes do strcmp
+    struct PistaNode* esquerda;
+    struct PistaNode* direita;
+    char conteudo[100];
+} PistaNode;
+
+// Estrutura para a Árvore da Mansão (Mapa)
+// Representa um cômodo, contendo nome, uma possível pista e caminhos.
+typedef struct Sala {
+    char nome[50];
+    char pista[100];        // Pista associada ao cômodo (pode ser vazia)
+    struct Sala* esquerda;  // Caminho à esquerda
+    struct Sala* direita;   // Caminho à direita
+} Sala;
+
+// Conjunto de digitais das pistas que já estão na BST (endereçamento aberto,
+// sondagem linear). Revisitar uma sala custa um hash e uma ou duas leituras,
+// em vez de descer a árvore inteira comparando textos.
+typedef struct {
+    uint64_t* digitais;     // 0 = posição vazia
+    const char** textos;    // Texto de cada digital, para confirmar colisões
+    int capacidade;         // Sempre potência de 2
+    int qtd;
+} ConjuntoDigitais;
+
+// Vetor de pistas para o modo de coleta adiada.
+// Cada visita só acrescenta um ponteiro para o texto da pista da sala (sem
+// malloc por pista e sem strcmp); a ordenação acontece uma vez, quando a
+// lista é exibida. Revisitas à mesma sala são descartadas pelo endereço do
+// texto, então o vetor nunca passa do número de salas com pista.
+typedef struct {
+    const char** itens;     // Referências às pistas das salas (não são cópias)
+    int qtd;
+    int capacidade;
+    bool ordenada;          // true = ordem alfabética e sem repetidas (após consolidar)
+    ConjuntoDigitais enderecos; // Endereços já registrados (chave = ponteiro, sem ler o texto)
+} ColetaPistas;
+
+// ============================================================================
+// VERSÃO A: BST (inserirPista)
+// ============================================================================
+
+/*
+ * Função: prefixoPista
+ * Converte os 8 primeiros bytes do texto em um inteiro big-endian
+ * (completando com zeros). Comparar esses inteiros dá o mesmo resultado
+ * que strcmp nos 8 primeiros bytes, mas sem ler a string do nó.
+ */
+uint64_t prefixoPista(const char* texto) {
+    uint64_t valor = 0;
+    int i = 0;
+    for (; i < 8 && texto[i] != '\0'; i++) valor = (valor << 8) | (unsigned char)texto[i];
+    for (; i < 8; i++) valor <<= 8;
+    return valor;
+}
+
+/*
+ * Função: inserirPistaComPrefixo
+ * Inserção recursiva recebendo o prefixo já calculado. O strcmp só é
+ * usado quando os 8 primeiros bytes empatam.
+ */
+PistaNode* inserirPistaComPrefixo(PistaNode* raiz, char* conteudo, uint64_t prefixo) {
+    // Caso base: posição vazia encontrada, cria o nó aqui
+    if (raiz == NULL) {
+        PistaNode* novo = (PistaNode*)malloc(sizeof(PistaNode));
+        if (novo) {
+            strcpy(novo->conteudo, conteudo);
+            novo->prefixo = prefixo;
+            novo->esquerda = NULL;
+            novo->direita = NULL;
+        }
+        return novo;
+    }
+
+    // Compara alfabeticamente para decidir o lado (Esquerda < Raiz < Direita)
+    int cmp;
+    if (prefixo != raiz->prefixo) cmp = (prefixo < raiz->prefixo) ? -1 : 1;
+    else if ((prefixo & 0xFF) == 0) cmp = 0; // O texto terminou dentro do prefixo: iguais
+    else cmp = strcmp(conteudo + 8, raiz->conteudo + 8);
+
+    if (cmp < 0) {
+        raiz->esquerda = inserirPistaComPrefixo(raiz->esquerda, conteudo, prefixo);
+    } else if (cmp > 0) {
+        raiz->direita = inserirPistaComPrefixo(raiz->direita, conteudo, prefixo);
+    }
+    // Se cmp == 0, a pista é igual e já existe; ignoramos para não duplicar.
+
+    return raiz;
+}
+
+/*
+ * Função: inserirPista
+ * Insere uma string na BST. Se a pista já existe, não duplica.
+ * Retorna a raiz atualizada da subárvore.
+ */
+PistaNode* inserirPista(PistaNode* raiz, char* conteudo) {
+    return inserirPistaComPrefixo(raiz, conteudo, prefixoPista(conteudo));
+}
+
+void liberarPistas(PistaNode* raiz) {
+    if (raiz != NULL) {
+        liberarPistas(raiz->esquerda);
+        liberarPistas(raiz->direita);
+        free(raiz);
+    }
+}
+
+// ============================================================================
+// CONJUNTO DE DIGITAIS (versão C, e por endereço na versão B)
+// ============================================================================
+
+/*
+ * Função: iniciarDigitais
+ * Prepara um conjunto vazio (a tabela só é alocada no primeiro registro).
+ */
+void iniciarDigitais(ConjuntoDigitais* conjunto) {
+    conjunto->digitais = NULL;
+    conjunto->textos = NULL;
+    conjunto->capacidade = 0;
+    conjunto->qtd = 0;
+}
+
+/*
+ * Função: digitalPista
+ * Hash FNV-1a de 64 bits do texto. O valor 0 marca posição vazia na
+ * tabela, então é trocado por 1.
+ */
+uint64_t digitalPista(const char* texto) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const unsigned char* c = (const unsigned char*)texto; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    return hash ? hash : 1;
+}
+
+// Auxiliar: coloca a digital na primeira posição vazia (sem verificar repetidas)
+void posicionarDigital(ConjuntoDigitais* conjunto, uint64_t digital, const char* texto) {
+    int mascara = conjunto->capacidade - 1;
+    int pos = (int)(digital & mascara);
+    while (conjunto->digitais[pos] != 0) pos = (pos + 1) & mascara;
+    conjunto->digitais[pos] = digital;
+    conjunto->textos[pos] = texto;
+}
+
+// Auxiliar: dobra a tabela e reposiciona as digitais (sem recalcular o hash)
+void crescerDigitais(ConjuntoDigitais* conjunto) {
+    ConjuntoDigitais antigo = *conjunto;
+    conjunto->capacidade = antigo.capacidade ? antigo.capacidade * 2 : 64;
+    conjunto->digitais = (uint64_t*)calloc(conjunto->capacidade, sizeof(uint64_t));
+    conjunto->textos = (const char**)malloc(conjunto->capacidade * sizeof(const char*));
+    if (conjunto->digitais == NULL || conjunto->textos == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (int i = 0; i < antigo.capacidade; i++) {
+        if (antigo.digitais[i] != 0) posicionarDigital(conjunto, antigo.digitais[i], antigo.textos[i]);
+    }
+    free(antigo.digitais);
+    free(antigo.textos);
+}
+
+/*
+ * Função: registrarDigital
+ * Retorna true se a pista é nova (e a registra) ou false se já foi vista.
+ * Digitais iguais com textos diferentes (colisão) são resolvidas com strcmp,
+ * então nenhuma pista é descartada por engano. O texto não é copiado: a
+ * sala precisa existir enquanto o conjunto existir.
+ */
+bool registrarDigital(ConjuntoDigitais* conjunto, const char* pista) {
+    // Mantém a ocupação abaixo de 70% para as sondagens continuarem curtas
+    if ((conjunto->qtd + 1) * 10 > conjunto->capacidade * 7) crescerDigitais(conjunto);
+
+    uint64_t digital = digitalPista(pista);
+    int mascara = conjunto->capacidade - 1;
+    int pos = (int)(digital & mascara);
+    while (conjunto->digitais[pos] != 0) {
+        if (conjunto->digitais[pos] == digital &&
+            (conjunto->textos[pos] == pista || strcmp(conjunto->textos[pos], pista) == 0)) {
+            return false; // Já vista
+        }
+        pos = (pos + 1) & mascara;
+    }
+    conjunto->digitais[pos] = digital;
+    conjunto->textos[pos] = pista;
+    conjunto->qtd++;
+    return true;
+}
+
+/*
+ * Função: registrarEndereco
+ * Como registrarDigital, mas a chave é o endereço do texto: a mesma sala
+ * sempre passa o mesmo ponteiro, então nenhum texto é lido. Salas
+ * diferentes com o mesmo texto contam como pistas distintas aqui.
+ */
+bool registrarEndereco(ConjuntoDigitais* conjunto, const char* pista) {
+    if ((conjunto->qtd + 1) * 10 > conjunto->capacidade * 7) crescerDigitais(conjunto);
+
+    // Mistura do splitmix64: endereços próximos caem em posições distantes
+    uint64_t digital = (uint64_t)(uintptr_t)pista;
+    digital = (digital ^ (digital >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    digital = (digital ^ (digital >> 27)) * 0x94D049BB133111EBULL;
+    digital ^= digital >> 31;
+    if (digital == 0) digital = 1;
+
+    int mascara = conjunto->capacidade - 1;
+    int pos = (int)(digital & mascara);
+    while (conjunto->digitais[pos] != 0) {
+        if (conjunto->textos[pos] == pista) return false; // Já registrado
+        pos = (pos + 1) & mascara;
+    }
+    conjunto->digitais[pos] = digital;
+    conjunto->textos[pos] = pista;
+    conjunto->qtd++;
+    return true;
+}
+
+void liberarDigitais(ConjuntoDigitais* conjunto) {
+    free(conjunto->digitais);
+    free(conjunto->textos);
+    iniciarDigitais(conjunto);
+}
+
+// ============================================================================
+// VERSÃO B: COLETA ADIADA (registrarPista + consolidarColeta)
+// ============================================================================
+
+/*
+ * Função: iniciarColeta
+ * Prepara um vetor de coleta vazio (a memória só é alocada no primeiro registro).
+ */
+void iniciarColeta(ColetaPistas* coleta) {
+    coleta->itens = NULL;
+    coleta->qtd = 0;
+    coleta->capacidade = 0;
+    coleta->ordenada = true; // Vetor vazio já está consolidado
+    iniciarDigitais(&coleta->enderecos);
+}
+
+/*
+ * Função: registrarPista
+ * Acrescenta a referência da pista ao fim do vetor: O(1) amortizado.
+ * Uma sala já registrada é ignorada (um hash do endereço, sem strcmp).
+ * O texto não é copiado, então a sala precisa existir até o relatório.
+ */
+void registrarPista(ColetaPistas* coleta, const char* pista) {
+    if (!registrarEndereco(&coleta->enderecos, pista)) return;
+    if (coleta->qtd == coleta->capacidade) {
+        int novaCapacidade = coleta->capacidade ? coleta->capacidade * 2 : 64;
+        const char** novos = (const char**)realloc(coleta->itens, novaCapacidade * sizeof(const char*));
+        if (novos == NULL) {
+            printf("Erro crítico: Falha na alocação de memória.\n");
+            exit(1);
+        }
+        coleta->itens = novos;
+        coleta->capacidade = novaCapacidade;
+    }
+    coleta->itens[coleta->qtd++] = pista;
+    coleta->ordenada = false;
+}
+
+// Auxiliar do qsort: ordem alfabética (a mesma do strcmp usado na BST)
+int compararTextos(const void* a, const void* b) {
+    const char* pa = *(const char* const*)a;
+    const char* pb = *(const char* const*)b;
+    if (pa == pb) return 0;
+    return strcmp(pa, pb);
+}
+
+// Auxiliar: ordena com 'comparar' e mantém só o primeiro de cada grupo igual
+void ordenarSemRepetidas(ColetaPistas* coleta, int (*comparar)(const void*, const void*)) {
+    qsort(coleta->itens, coleta->qtd, sizeof(const char*), comparar);
+    int total = 0;
+    for (int i = 0; i < coleta->qtd; i++) {
+        if (total == 0 || comparar(&coleta->itens[total - 1], &coleta->itens[i]) != 0) {
+            coleta->itens[total++] = coleta->itens[i];
+        }
+    }
+    coleta->qtd = total;
+}
+
+/*
+ * Função: consolidarColeta
+ * Ordena alfabeticamente e remove pistas repetidas. Chamada no relatório.
+ */
+void consolidarColeta(ColetaPistas* coleta) {
+    if (coleta->ordenada) return;
+    ordenarSemRepetidas(coleta, compararTextos);
+    coleta->ordenada = true;
+}
+
+void liberarColeta(ColetaPistas* coleta) {
+    free(coleta->itens);
+    liberarDigitais(&coleta->enderecos);
+    iniciarColeta(coleta);
+}
+
+// Auxiliar: percurso Em-Ordem copiando as referências (equivalente ao exibirPistas)
+void coletarEmOrdem(PistaNode* raiz, const char** destino, int* qtd) {
+    if (raiz != NULL) {
+        coletarEmOrdem(raiz->esquerda, destino, qtd);
+        destino[(*qtd)++] = raiz->conteudo;
+        coletarEmOrdem(raiz->direita, destino, qtd);
+    }
+}
+
+// ============================================================================
+// MANSÃO GRANDE E MEDIÇÃO
+// ============================================================================
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+// Cria 'qtdSalas' salas ligadas em uma árvore binária aleatória.
+// A pista de cada sala é sorteada de um conjunto de 'qtdPistas' textos.
+Sala** gerarMansao(int qtdSalas, int qtdPistas) {
+    const char* objetos[] = {"Pegadas de lama", "Relógio parado", "Livro de venenos", "Taça quebrada",
+                             "Chave enferrujada", "Carta rasgada", "Luva manchada", "Vela apagada"};
+    const char* locais[] = {"perto da janela", "sob o tapete", "atrás da estante", "no corredor"};
+    Sala** salas = (Sala**)malloc(qtdSalas * sizeof(Sala*));
+    if (salas == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (int i = 0; i < qtdSalas; i++) {
+        salas[i] = (Sala*)malloc(sizeof(Sala));
+        if (salas[i] == NULL) {
+            printf("Erro crítico: Falha na alocação de memória.\n");
+            exit(1);
+        }
+        sprintf(salas[i]->nome, "Sala %d", i);
+        int p = aleatorio() % qtdPistas;
+        if (i % 5 == 4) salas[i]->pista[0] = '\0'; // Algumas salas sem pista
+        else sprintf(salas[i]->pista, "%s %s (registro %d)", objetos[p % 8], locais[(p / 8) % 4], p);
+        salas[i]->esquerda = NULL;
+        salas[i]->direita = NULL;
+        if (i > 0) {
+            // Pendura a sala em uma posição livre de uma sala anterior
+            while (true) {
+                Sala* pai = salas[aleatorio() % i];
+                if (pai->esquerda == NULL) { pai->esquerda = salas[i]; break; }
+                if (pai->direita == NULL) { pai->direita = salas[i]; break; }
+            }
+        }
+    }
+    return salas;
+}
+
+// Sorteia as salas visitadas: caminhadas da entrada até um beco sem saída
+Sala** gerarVisitas(Sala* entrada, long qtdVisitas) {
+    Sala** visitas = (Sala**)malloc(qtdVisitas * sizeof(Sala*));
+    if (visitas == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    Sala* atual = entrada;
+    for (long v = 0; v < qtdVisitas; v++) {
+        visitas[v] = atual;
+        Sala* proxima = (rand() % 2) ? atual->esquerda : atual->direita;
+        if (proxima == NULL) proxima = atual->esquerda ? atual->esquerda : atual->direita;
+        atual = proxima ? proxima : entrada; // Beco sem saída: nova sessão
+    }
+    return visitas;
+}
+
+void medir(int qtdSalas, int qtdPistas, long qtdVisitas) {
+    Sala** salas = gerarMansao(qtdSalas, qtdPistas);
+    Sala** visitas = gerarVisitas(salas[0], qtdVisitas);
+    printf("\n--- %d salas, %d pistas diferentes, %ld visitas ---\n", qtdSalas, qtdPistas, qtdVisitas);
+
+    // Versão A: BST
+    clock_t inicio = clock();
+    PistaNode* raiz = NULL;
+    for (long v = 0; v < qtdVisitas; v++) {
+        if (visitas[v]->pista[0] != '\0') raiz = inserirPista(raiz, visitas[v]->pista);
+    }
+    clock_t fim = clock();
+    double exploracaoA = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    const char** listaA = (const char**)malloc((qtdPistas + 1) * sizeof(const char*));
+    int qtdA = 0;
+    inicio = clock();
+    coletarEmOrdem(raiz, listaA, &qtdA);
+    fim = clock();
+    double relatorioA = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    // Versão B: coleta adiada
+    ColetaPistas coleta;
+    iniciarColeta(&coleta);
+    inicio = clock();
+    for (long v = 0; v < qtdVisitas; v++) {
+        if (visitas[v]->pista[0] != '\0') registrarPista(&coleta, visitas[v]->pista);
+    }
+    fim = clock();
+    double exploracaoB = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    double bytesB = coleta.capacidade * (double)sizeof(const char*) +
+                    coleta.enderecos.capacidade * (double)(sizeof(uint64_t) + sizeof(const char*));
+
+    inicio = clock();
+    consolidarColeta(&coleta);
+    fim = clock();
+    double relatorioB = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    // Versão C: BST com digitais
+    ConjuntoDigitais vistas;
+    iniciarDigitais(&vistas);
+    PistaNode* raizC = NULL;
+    inicio = clock();
+    for (long v = 0; v < qtdVisitas; v++) {
+        if (visitas[v]->pista[0] != '\0' && registrarDigital(&vistas, visitas[v]->pista)) {
+            raizC = inserirPista(raizC, visitas[v]->pista);
+        }
+    }
+    fim = clock();
+    double exploracaoC = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    const char** listaC = (const char**)malloc((qtdPistas + 1) * sizeof(const char*));
+    int qtdC = 0;
+    inicio = clock();
+    coletarEmOrdem(raizC, listaC, &qtdC);
+    fim = clock();
+    double relatorioC = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    bool confere = (qtdA == coleta.qtd && qtdA == qtdC);
+    for (int i = 0; confere && i < qtdA; i++) {
+        confere = (strcmp(listaA[i], coleta.itens[i]) == 0 && strcmp(listaA[i], listaC[i]) == 0);
+    }
+
+    printf("%-22s %14s %14s %14s\n", "", "BST", "Adiada", "BST+digitais");
+    printf("%-22s %14.3f %14.3f %14.3f\n", "Exploracao (s)", exploracaoA, exploracaoB, exploracaoC);
+    printf("%-22s %14.3f %14.3f %14.3f\n", "Relatorio (s)", relatorioA, relatorioB, relatorioC);
+    printf("%-22s %14.1f %14.1f %14.1f\n", "ns por visita",
+           exploracaoA * 1e9 / qtdVisitas, exploracaoB * 1e9 / qtdVisitas, exploracaoC * 1e9 / qtdVisitas);
+    printf("%-22s %14.2f %14.2f %14.2f\n", "Memoria (MB)",
+           qtdA * (double)sizeof(PistaNode) / (1024.0 * 1024.0),
+           bytesB / (1024.0 * 1024.0),
+           (qtdC * (double)sizeof(PistaNode) + vistas.capacidade * (sizeof(uint64_t) + sizeof(const char*))) /
+               (1024.0 * 1024.0));
+    printf("Pistas distintas: %d | Listas %s\n", coleta.qtd, confere ? "CONFEREM" : "DIVERGEM (ERRO!)");
+
+    liberarPistas(raiz);
+    liberarPistas(raizC);
+    liberarDigitais(&vistas);
+    free(listaC);
+    liberarColeta(&coleta);
+    free(listaA);
+    free(visitas);
+    for (int i = 0; i < qtdSalas; i++) free(salas[i]);
+    free(salas);
+}
+
+int main(int argc, char* argv[]) {
+    long qtdVisitas = 10000000;
+    if (argc > 1 && atol(argv[1]) > 0) qtdVisitas = atol(argv[1]);
+
+    printf("========================================================\n");
+    printf("   COLETA DE PISTAS: BST vs ADIADA vs BST + DIGITAIS\n");
+    printf("========================================================\n");
+
+    srand(42);
+    medir(1000, 200, qtdVisitas);        // Poucas pistas, muito repetidas
+    medir(200000, 100000, qtdVisitas);   // Mansão grande, pistas variadas
+
+    printf("\nFim do programa.\n");
+    return 0;
+}
@@ -0,0 +1,616 @@
+/*
+ * Objetivo: Comparar BST, Trie e Tabela Hash encadeada com um dicionário de
+ *           verdade (ou um gerado com distribuição realista), em vez das seis
+ *           palavras fixas do BST_TRIE.c.
+ *
+ * Estruturas medidas (cópias fiéis dos programas do projeto):
+ *   1. NoBST     - BST_TRIE.c (com prefixo de 8 bytes em cache)
+ *   2. NoTrie    - BST_TRIE.c (mapa de 256 bits + vetor denso de filhos)
+ *   3. HashNode  - Detective_Quest_Mestre.c (encadeamento, TAM_HASH fixo)
+ *
+ * Métricas: tempo de construção, vazão de inserção, latência de buscas com
+ * acerto e com erro (média, p50 e p99) e memória ocupada.
+ *
+ * Uso:
+ *   ./Benchmark_Estruturas [-c corpus.txt] [-n quantidade] [--csv saida.csv] [--json saida.json]
+ *
+ * Observação: o relógio (timespec_get) tem resolução grosseira em muitas
+ * máquinas, então cada amostra de latência é a média de um lote de
+ * TAM_LOTE buscas consecutivas. p50/p99 são calculados sobre essas amostras.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+
+#define TAM_PALAVRA 50   // Mesmo limite do NoBST
+#define TAM_HASH 31      // Mesmo tamanho do Detective_Quest_Mestre.c
+#define TAM_LOTE 16      // Buscas por amostra de latência
+
+// ============================================================================
+// ESTRUTURA 1: BST (BST_TRIE.c)
+// ============================================================================
+
+typedef struct NoBST {
+    uint64_t prefixo;
+    struct NoBST* esquerda;
+    struct NoBST* direita;
+    char palavra[TAM_PALAVRA];
+} NoBST;
+
+uint64_t prefixoChave(const char* palavra) {
+    uint64_t valor = 0;
+    int i = 0;
+    for (; i < 8 && palavra[i] != '\0'; i++) valor = (valor << 8) | (unsigned char)palavra[i];
+    for (; i < 8; i++) valor <<= 8;
+    return valor;
+}
+
+int compararChave(const char* palavra, uint64_t prefixo, NoBST* no) {
+    if (prefixo != no->prefixo) return (prefixo < no->prefixo) ? -1 : 1;
+    if ((prefixo & 0xFF) == 0) return 0;
+    return strcmp(palavra + 8, no->palavra + 8);
+}
+
+NoBST* criarNoBST(char* palavra) {
+    NoBST* novo = (NoBST*)malloc(sizeof(NoBST));
+    if (novo) {
+        strcpy(novo->palavra, palavra);
+        novo->prefixo = prefixoChave(palavra);
+        novo->esquerda = NULL;
+        novo->direita = NULL;
+    }
+    return novo;
+}
+
+NoBST* inserirBSTComPrefixo(NoBST* raiz, char* palavra, uint64_t prefixo) {
+    if (raiz == NULL) return criarNoBST(palavra);
+    int cmp = compararChave(palavra, prefixo, raiz);
+    if (cmp < 0) raiz->esquerda = inserirBSTComPrefixo(raiz->esquerda, palavra, prefixo);
+    else if (cmp > 0) raiz->direita = inserirBSTComPrefixo(raiz->direita, palavra, prefixo);
+    return raiz;
+}
+
+NoBST* inserirBST(NoBST* raiz, char* palavra) {
+    return inserirBSTComPrefixo(raiz, palavra, prefixoChave(palavra));
+}
+
+bool buscarBSTComPrefixo(NoBST* raiz, char* palavra, uint64_t prefixo) {
+    if (raiz == NULL) return false;
+    int cmp = compararChave(palavra, prefixo, raiz);
+    if (cmp == 0) return true;
+    else if (cmp < 0) return buscarBSTComPrefixo(raiz->esquerda, palavra, prefixo);
+    else return buscarBSTComPrefixo(raiz->direita, palavra, prefixo);
+}
+
+bool buscarBST(NoBST* raiz, char* palavra) {
+    return buscarBSTComPrefixo(raiz, palavra, prefixoChave(palavra));
+}
+
+long contarNosBST(NoBST* raiz) {
+    if (raiz == NULL) return 0;
+    return 1 + contarNosBST(raiz->esquerda) + contarNosBST(raiz->direita);
+}
+
+void liberarBST(NoBST* raiz) {
+    if (raiz != NULL) {
+        liberarBST(raiz->esquerda);
+        liberarBST(raiz->direita);
+        free(raiz);
+    }
+}
+
+// ============================================================================
+// ESTRUTURA 2: TRIE (BST_TRIE.c)
+// ============================================================================
+
+typedef struct NoTrie {
+    uint64_t mapa[4];
+    struct NoTrie** filhos;
+    unsigned short qtdFilhos;
+    bool fimDaPalavra;
+} NoTrie;
+
+int contarBits(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int total = 0;
+    while (x) { x &= x - 1; total++; }
+    return total;
+#endif
+}
+
+int posicaoFilho(NoTrie* no, int b) {
+    int palavra = b >> 6;
+    uint64_t antes = no->mapa[palavra] & ((1ULL << (b & 63)) - 1);
+    int pos = contarBits(antes);
+    for (int i = 0; i < palavra; i++) pos += contarBits(no->mapa[i]);
+    return pos;
+}
+
+NoTrie* obterFilho(NoTrie* no, int b) {
+    if (!(no->mapa[b >> 6] & (1ULL << (b & 63)))) return NULL;
+    return no->filhos[posicaoFilho(no, b)];
+}
+
+NoTrie* criarNoTrie() {
+    NoTrie* novo = (NoTrie*)malloc(sizeof(NoTrie));
+    if (novo) {
+        novo->fimDaPalavra = false;
+        for (int i = 0; i < 4; i++) novo->mapa[i] = 0;
+        novo->filhos = NULL;
+        novo->qtdFilhos = 0;
+    }
+    return novo;
+}
+
+NoTrie* adicionarFilho(NoTrie* no, int b) {
+    NoTrie* filho = criarNoTrie();
+    NoTrie** novos = (NoTrie**)realloc(no->filhos, (no->qtdFilhos + 1) * sizeof(NoTrie*));
+    if (filho == NULL || novos == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    int pos = posicaoFilho(no, b);
+    memmove(&novos[pos + 1], &novos[pos], (no->qtdFilhos - pos) * sizeof(NoTrie*));
+    novos[pos] = filho;
+    no->filhos = novos;
+    no->qtdFilhos++;
+    no->mapa[b >> 6] |= 1ULL << (b & 63);
+    return filho;
+}
+
+int charParaIndice(char c) {
+    unsigned char b = (unsigned char)c;
+    if (b < 128) return tolower(b);
+    return b;
+}
+
+void inserirTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+        NoTrie* proximo = obterFilho(atual, indice);
+        if (proximo == NULL) proximo = adicionarFilho(atual, indice);
+        atual = proximo;
+    }
+    atual->fimDaPalavra = true;
+}
+
+bool buscarTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        atual = obterFilho(atual, charParaIndice(palavra[i]));
+        if (atual == NULL) return false;
+    }
+    return (atual != NULL && atual->fimDaPalavra);
+}
+
+void medirTrie(NoTrie* raiz, long* qtdNos, long* bytes) {
+    if (raiz == NULL) return;
+    (*qtdNos)++;
+    *bytes += sizeof(NoTrie) + raiz->qtdFilhos * sizeof(NoTrie*);
+    for (int i = 0; i < raiz->qtdFilhos; i++) medirTrie(raiz->filhos[i], qtdNos, bytes);
+}
+
+void liberarTrie(NoTrie* raiz) {
+    if (raiz == NULL) return;
+    for (int i = 0; i < raiz->qtdFilhos; i++) liberarTrie(raiz->filhos[i]);
+    free(raiz->filhos);
+    free(raiz);
+}
+
+// ============================================================================
+// ESTRUTURA 3: TABELA HASH ENCADEADA (Detective_Quest_Mestre.c)
+// ============================================================================
+
+typedef struct HashNode {
+    char pista[100];
+    char suspeito[50];
+    struct HashNode* proximo;
+} HashNode;
+
+// Igual ao original, exceto pelo cast: somando char com sinal, bytes UTF-8
+// (ex: "ção") deixam a soma negativa e o índice fora da tabela.
+int funcaoHash(char* chave) {
+    int soma = 0;
+    for (int i = 0; chave[i] != '\0'; i++) {
+        soma += (unsigned char)chave[i];
+    }
+    return soma % TAM_HASH;
+}
+
+void inserirNaHash(HashNode* tabela[], char* pista, char* suspeito) {
+    int indice = funcaoHash(pista);
+    HashNode* novo = (HashNode*)malloc(sizeof(HashNode));
+    if (novo) {
+        strcpy(novo->pista, pista);
+        strcpy(novo->suspeito, suspeito);
+        novo->proximo = tabela[indice];
+        tabela[indice] = novo;
+    }
+}
+
+char* encontrarSuspeito(HashNode* tabela[], char* pista) {
+    int indice = funcaoHash(pista);
+    HashNode* atual = tabela[indice];
+    while (atual != NULL) {
+        if (strcmp(atual->pista, pista) == 0) return atual->suspeito;
+        atual = atual->proximo;
+    }
+    return NULL;
+}
+
+void liberarHash(HashNode* tabela[]) {
+    for (int i = 0; i < TAM_HASH; i++) {
+        HashNode* atual = tabela[i];
+        while (atual != NULL) {
+            HashNode* temp = atual;
+            atual = atual->proximo;
+            free(temp);
+        }
+    }
+}
+
+// ============================================================================
+// CORPUS
+// ============================================================================
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+int compararStrings(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+// Remove repetidas (ordena e compacta) e embaralha. Retorna a nova quantidade.
+int prepararCorpus(char** palavras, int qtd) {
+    qsort(palavras, qtd, sizeof(char*), compararStrings);
+    int unicas = 0;
+    for (int i = 0; i < qtd; i++) {
+        if (unicas > 0 && strcmp(palavras[i], palavras[unicas - 1]) == 0) {
+            free(palavras[i]);
+            continue;
+        }
+        palavras[unicas++] = palavras[i];
+    }
+    for (int i = unicas - 1; i > 0; i--) {
+        int j = aleatorio() % (i + 1);
+        char* temp = palavras[i];
+        palavras[i] = palavras[j];
+        palavras[j] = temp;
+    }
+    return unicas;
+}
+
+// Lê uma palavra por linha (até 'maximo'). Retorna a quantidade lida.
+int carregarCorpus(const char* caminho, char** palavras, int maximo) {
+    FILE* arquivo = fopen(caminho, "r");
+    if (arquivo == NULL) return 0;
+    char linha[256];
+    int qtd = 0;
+    while (qtd < maximo && fgets(linha, sizeof(linha), arquivo)) {
+        if (strchr(linha, '\n') == NULL && !feof(arquivo)) {
+            int c;
+            while ((c = fgetc(arquivo)) != '\n' && c != EOF); // Descarta o resto da linha longa
+            continue;
+        }
+        linha[strcspn(linha, "\r\n")] = '\0';
+        if (linha[0] == '\0' || strlen(linha) >= TAM_PALAVRA - 2) continue;
+        palavras[qtd] = (char*)malloc(strlen(linha) + 1);
+        strcpy(palavras[qtd++], linha);
+    }
+    fclose(arquivo);
+    return qtd;
+}
+
+/*
+ * gerarCorpus() – palavras com distribuição parecida com a de um dicionário:
+ * sílabas escolhidas com frequência de Zipf (as primeiras são muito mais
+ * comuns, criando prefixos compartilhados) e 2 a 6 sílabas por palavra,
+ * concentradas em 3-4 (7 a 10 letras).
+ */
+int gerarCorpus(char** palavras, int qtd) {
+    const char* silabas[] = {
+        "de", "ca", "co", "ra", "ta", "ma", "pa", "re", "to", "ni",
+        "li", "men", "te", "sa", "do", "ri", "ção", "es", "con", "ar",
+        "in", "tra", "pro", "ve", "bo", "ne", "gu", "fi", "so", "por",
+        "lu", "cha", "que", "vi", "mo", "ga", "zi", "pre", "ber", "sol"
+    };
+    int qtdSilabas = sizeof(silabas) / sizeof(silabas[0]);
+
+    // Pesos de Zipf acumulados: peso(k) = 1 / (k + 1)
+    double acumulado[64], total = 0;
+    for (int k = 0; k < qtdSilabas; k++) {
+        total += 1.0 / (k + 1);
+        acumulado[k] = total;
+    }
+    const double tamanhos[] = {0.10, 0.30, 0.33, 0.18, 0.09}; // 2 a 6 sílabas
+
+    for (int i = 0; i < qtd; i++) {
+        double sorteio = (double)aleatorio() / (1 << 30);
+        int partes = 2;
+        double soma = 0;
+        for (int t = 0; t < 5; t++) {
+            soma += tamanhos[t];
+            if (sorteio < soma) { partes = 2 + t; break; }
+        }
+
+        char palavra[TAM_PALAVRA] = "";
+        for (int p = 0; p < partes; p++) {
+            double alvo = (double)aleatorio() / (1 << 30) * total;
+            int k = 0;
+            while (k < qtdSilabas - 1 && acumulado[k] < alvo) k++;
+            strcat(palavra, silabas[k]);
+        }
+        palavras[i] = (char*)malloc(strlen(palavra) + 1);
+        strcpy(palavras[i], palavra);
+    }
+    return qtd;
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+typedef struct {
+    const char* estrutura;
+    int qtdPalavras;
+    double construcaoSeg;
+    double insercoesPorSeg;
+    double acertoMedioNs, acertoP50Ns, acertoP99Ns;
+    double erroMedioNs, erroP50Ns, erroP99Ns;
+    long memoriaBytes;
+} Resultado;
+
+typedef enum { EST_BST, EST_TRIE, EST_HASH } TipoEstrutura;
+
+// Relógio de alta resolução (C11)
+double agoraNs() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int compararDouble(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Ordena as latências e calcula média, p50 e p99
+void resumirLatencias(double* lat, int qtd, double* media, double* p50, double* p99) {
+    double soma = 0;
+    for (int i = 0; i < qtd; i++) soma += lat[i];
+    qsort(lat, qtd, sizeof(double), compararDouble);
+    *media = soma / qtd;
+    *p50 = lat[(int)(0.50 * (qtd - 1))];
+    *p99 = lat[(int)(0.99 * (qtd - 1))];
+}
+
+// Estado de uma estrutura em teste
+typedef struct {
+    TipoEstrutura tipo;
+    NoBST* bst;
+    NoTrie* trie;
+    HashNode* hash[TAM_HASH];
+} Estrutura;
+
+bool buscar(Estrutura* e, char* palavra) {
+    switch (e->tipo) {
+        case EST_BST:  return buscarBST(e->bst, palavra);
+        case EST_TRIE: return buscarTrie(e->trie, palavra);
+        default:       return encontrarSuspeito(e->hash, palavra) != NULL;
+    }
+}
+
+Resultado medirEstrutura(TipoEstrutura tipo, char** palavras, int qtd,
+                         char** acertos, char** erros, int qtdConsultas) {
+    Resultado r;
+    memset(&r, 0, sizeof(r));
+    r.estrutura = (tipo == EST_BST) ? "BST" : (tipo == EST_TRIE) ? "Trie" : "Hash";
+    r.qtdPalavras = qtd;
+
+    Estrutura e;
+    memset(&e, 0, sizeof(e));
+    e.tipo = tipo;
+    if (tipo == EST_TRIE) e.trie = criarNoTrie();
+
+    // 1. Construção
+    double inicio = agoraNs();
+    for (int i = 0; i < qtd; i++) {
+        if (tipo == EST_BST) e.bst = inserirBST(e.bst, palavras[i]);
+        else if (tipo == EST_TRIE) inserirTrie(e.trie, palavras[i]);
+        else inserirNaHash(e.hash, palavras[i], "Suspeito");
+    }
+    double fim = agoraNs();
+    r.construcaoSeg = (fim - inicio) / 1e9;
+    r.insercoesPorSeg = qtd / r.construcaoSeg;
+
+    // 2. Latência por busca (acertos e erros), em lotes de TAM_LOTE buscas
+    int qtdAmostras = qtdConsultas / TAM_LOTE;
+    double* lat = (double*)malloc(qtdAmostras * sizeof(double));
+    long encontrados = 0;
+    for (int a = 0; a < qtdAmostras; a++) {
+        double t0 = agoraNs();
+        for (int i = a * TAM_LOTE; i < (a + 1) * TAM_LOTE; i++) encontrados += buscar(&e, acertos[i]);
+        lat[a] = (agoraNs() - t0) / TAM_LOTE;
+    }
+    resumirLatencias(lat, qtdAmostras, &r.acertoMedioNs, &r.acertoP50Ns, &r.acertoP99Ns);
+    for (int a = 0; a < qtdAmostras; a++) {
+        double t0 = agoraNs();
+        for (int i = a * TAM_LOTE; i < (a + 1) * TAM_LOTE; i++) encontrados += buscar(&e, erros[i]);
+        lat[a] = (agoraNs() - t0) / TAM_LOTE;
+    }
+    resumirLatencias(lat, qtdAmostras, &r.erroMedioNs, &r.erroP50Ns, &r.erroP99Ns);
+    free(lat);
+    qtdConsultas = qtdAmostras * TAM_LOTE;
+
+    if (encontrados != qtdConsultas) {
+        printf("[ERRO] %s: %ld buscas deram acerto, esperado %d\n", r.estrutura, encontrados, qtdConsultas);
+    }
+
+    // 3. Memória (sem o cabeçalho interno do malloc)
+    if (tipo == EST_BST) {
+        r.memoriaBytes = contarNosBST(e.bst) * (long)sizeof(NoBST);
+        liberarBST(e.bst);
+    } else if (tipo == EST_TRIE) {
+        long nos = 0;
+        medirTrie(e.trie, &nos, &r.memoriaBytes);
+        liberarTrie(e.trie);
+    } else {
+        r.memoriaBytes = (long)qtd * sizeof(HashNode) + sizeof(e.hash);
+        liberarHash(e.hash);
+    }
+    return r;
+}
+
+void salvarCSV(const char* caminho, Resultado* res, int qtd) {
+    FILE* f = fopen(caminho, "w");
+    if (f == NULL) {
+        printf("[ERRO] Não foi possível criar '%s'.\n", caminho);
+        return;
+    }
+    fprintf(f, "estrutura,palavras,construcao_s,insercoes_por_s,"
+               "acerto_medio_ns,acerto_p50_ns,acerto_p99_ns,"
+               "erro_medio_ns,erro_p50_ns,erro_p99_ns,memoria_bytes\n");
+    for (int i = 0; i < qtd; i++) {
+        Resultado* r = &res[i];
+        fprintf(f, "%s,%d,%.6f,%.0f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%ld\n",
+                r->estrutura, r->qtdPalavras, r->construcaoSeg, r->insercoesPorSeg,
+                r->acertoMedioNs, r->acertoP50Ns, r->acertoP99Ns,
+                r->erroMedioNs, r->erroP50Ns, r->erroP99Ns, r->memoriaBytes);
+    }
+    fclose(f);
+}
+
+// Auxiliar: texto como string JSON (aspas, barra e caracteres de controle escapados).
+// Caminhos do Windows ("C:\dados\corpus.txt") precisam do escape da barra.
+void escreverTextoJSON(FILE* f, const char* texto) {
+    for (; *texto != '\0'; texto++) {
+        unsigned char c = (unsigned char)*texto;
+        if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+        else if (c < 0x20) fprintf(f, "\\u%04x", c);
+        else fputc(c, f);
+    }
+}
+
+void salvarJSON(const char* caminho, const char* corpus, Resultado* res, int qtd) {
+    FILE* f = fopen(caminho, "w");
+    if (f == NULL) {
+        printf("[ERRO] Não foi possível criar '%s'.\n", caminho);
+        return;
+    }
+    fprintf(f, "{\n  \"corpus\": \"");
+    escreverTextoJSON(f, corpus);
+    fprintf(f, "\",\n  \"resultados\": [\n");
+    for (int i = 0; i < qtd; i++) {
+        Resultado* r = &res[i];
+        fprintf(f, "    {\"estrutura\": \"%s\", \"palavras\": %d, \"construcao_s\": %.6f, "
+                   "\"insercoes_por_s\": %.0f, "
+                   "\"acerto_ns\": {\"media\": %.1f, \"p50\": %.1f, \"p99\": %.1f}, "
+                   "\"erro_ns\": {\"media\": %.1f, \"p50\": %.1f, \"p99\": %.1f}, "
+                   "\"memoria_bytes\": %ld}%s\n",
+                r->estrutura, r->qtdPalavras, r->construcaoSeg, r->insercoesPorSeg,
+                r->acertoMedioNs, r->acertoP50Ns, r->acertoP99Ns,
+                r->erroMedioNs, r->erroP50Ns, r->erroP99Ns, r->memoriaBytes,
+                (i + 1 < qtd) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    const char* arquivoCorpus = NULL;
+    const char* arquivoCSV = NULL;
+    const char* arquivoJSON = NULL;
+    int qtdDesejada = 100000;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) arquivoCorpus = argv[++i];
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) qtdDesejada = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) arquivoCSV = argv[++i];
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) arquivoJSON = argv[++i];
+        else {
+            printf("Uso: %s [-c corpus.txt] [-n quantidade] [--csv saida.csv] [--json saida.json]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (qtdDesejada <= 0) qtdDesejada = 100000;
+
+    srand(42);
+    // O corpus gerado tem repetições (sílabas comuns), então sorteamos 3x mais
+    char** palavras = (char**)malloc(3 * (size_t)qtdDesejada * sizeof(char*));
+    int qtd = 0;
+    if (arquivoCorpus != NULL) qtd = carregarCorpus(arquivoCorpus, palavras, qtdDesejada);
+    if (qtd == 0) {
+        if (arquivoCorpus != NULL) printf("Não foi possível ler '%s'. Usando corpus gerado.\n", arquivoCorpus);
+        arquivoCorpus = "gerado";
+        qtd = gerarCorpus(palavras, 3 * qtdDesejada);
+    }
+    qtd = prepararCorpus(palavras, qtd);
+    while (qtd > qtdDesejada) free(palavras[--qtd]);
+
+    // Consultas: acertos sorteados do corpus; erros = palavra + "zq" (nunca gerada)
+    int qtdConsultas = qtd < 20000 ? qtd : 20000;
+    if (qtdConsultas < TAM_LOTE) {
+        printf("Corpus muito pequeno (%d palavras).\n", qtd);
+        return 1;
+    }
+    char** acertos = (char**)malloc(qtdConsultas * sizeof(char*));
+    char** erros = (char**)malloc(qtdConsultas * sizeof(char*));
+    for (int i = 0; i < qtdConsultas; i++) {
+        acertos[i] = palavras[aleatorio() % qtd];
+        char* base = palavras[aleatorio() % qtd];
+        erros[i] = (char*)malloc(strlen(base) + 3);
+        sprintf(erros[i], "%szq", base);
+    }
+
+    printf("========================================================\n");
+    printf("       BENCHMARK: BST vs TRIE vs HASH (%d palavras)\n", qtd);
+    printf("========================================================\n");
+    printf("Corpus: %s | Consultas: %d acertos + %d erros\n\n", arquivoCorpus, qtdConsultas, qtdConsultas);
+
+    Resultado res[3];
+    TipoEstrutura tipos[3] = { EST_BST, EST_TRIE, EST_HASH };
+    for (int i = 0; i < 3; i++) {
+        res[i] = medirEstrutura(tipos[i], palavras, qtd, acertos, erros, qtdConsultas);
+    }
+
+    printf("%-24s %14s %14s %14s\n", "", "BST", "Trie", "Hash");
+    printf("%-24s %14.3f %14.3f %14.3f\n", "Construcao (s)", res[0].construcaoSeg, res[1].construcaoSeg, res[2].construcaoSeg);
+    printf("%-24s %14.0f %14.0f %14.0f\n", "Insercoes por segundo", res[0].insercoesPorSeg, res[1].insercoesPorSeg, res[2].insercoesPorSeg);
+    printf("%-24s %14.1f %14.1f %14.1f\n", "Acerto p50 (ns)", res[0].acertoP50Ns, res[1].acertoP50Ns, res[2].acertoP50Ns);
+    printf("%-24s %14.1f %14.1f %14.1f\n", "Acerto p99 (ns)", res[0].acertoP99Ns, res[1].acertoP99Ns, res[2].acertoP99Ns);
+    printf("%-24s %14.1f %14.1f %14.1f\n", "Erro p50 (ns)", res[0].erroP50Ns, res[1].erroP50Ns, res[2].erroP50Ns);
+    printf("%-24s %14.1f %14.1f %14.1f\n", "Erro p99 (ns)", res[0].erroP99Ns, res[1].erroP99Ns, res[2].erroP99Ns);
+    printf("%-24s %14.1f %14.1f %14.1f\n", "Memoria (MB)",
+           res[0].memoriaBytes / 1048576.0, res[1].memoriaBytes / 1048576.0, res[2].memoriaBytes / 1048576.0);
+    printf("\n(Hash com TAM_HASH = %d fixo: cada lista tem ~%d pistas.)\n", TAM_HASH, qtd / TAM_HASH);
+
+    if (arquivoCSV) {
+        salvarCSV(arquivoCSV, res, 3);
+        printf("Resultados gravados em '%s'\n", arquivoCSV);
+    }
+    if (arquivoJSON) {
+        salvarJSON(arquivoJSON, arquivoCorpus, res, 3);
+        printf("Resultados gravados em '%s'\n", arquivoJSON);
+    }
+
+    for (int i = 0; i < qtdConsultas; i++) free(erros[i]);
+    for (int i = 0; i < qtd; i++) free(palavras[i]);
+    free(erros);
+    free(acertos);
+    free(palavras);
+    return 0;
+}
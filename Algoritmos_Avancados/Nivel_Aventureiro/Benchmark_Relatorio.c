@@ -0,0 +1,346 @@
+/*
+ * Objetivo: Medir o relatório de pistas do Detective_Quest_Pistas.c com
+ *           milhões de pistas: um printf por pista vs escritor com buffer.
+ *
+ * Versão A: fprintf("- %s\n") por nó, como o exibirPistas original.
+ * Versão B: EscritorRelatorio em texto (mesma saída byte a byte).
+ * Versão C: EscritorRelatorio em NDJSON.
+ * Versão D: EscritorRelatorio com prefixo de tamanho (sem formatação).
+ *
+ * A saída vai para um arquivo temporário, então o tempo medido é o de
+ * formatar e entregar ao sistema, não o do terminal.
+ *
+ * Uso: ./Benchmark_Relatorio [qtd_pistas]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <time.h>
+#ifdef _WIN32
+#include <io.h>
+#define write _write // MSYS2/ucrt: mesma função com outro nome
+#define fileno _fileno
+#else
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// ESTRUTURAS E FUNÇÕES (iguais ao Detective_Quest_Pistas.c)
+// ============================================================================
+
+// Estrutura para a Árvore de Pistas (BST)
+// Armazena o texto da pista e ponteiros para ordenação.
+typedef struct PistaNode {
+    uint64_t prefixo;              // 8 primeiros bytes do conteúdo (big-endian), comparados antes do strcmp
+    struct PistaNode* esquerda;
+    struct PistaNode* direita;
+    char conteudo[100];
+} PistaNode;
+
+// Escritor de relatórios: acumula a saída em um buffer grande e só chama
+// write() quando ele enche (em vez de um printf por pista).
+#define TAM_BUFFER_RELATORIO (64 * 1024)
+
+typedef enum {
+    FORMATO_TEXTO,   // "- pista\n" (mesmo texto do printf original)
+    FORMATO_NDJSON,  // {"pista":"..."} por linha
+    FORMATO_TAMANHO  // 4 bytes little-endian com o tamanho + bytes da pista
+} FormatoRelatorio;
+
+typedef struct {
+    int fd;                  // Descritor de saída (1 = stdout)
+    FormatoRelatorio formato;
+    size_t usados;           // Bytes ocupados no buffer
+    long chamadasWrite;
+    bool erro;
+    char buffer[TAM_BUFFER_RELATORIO];
+} EscritorRelatorio;
+
+/*
+ * Função: prefixoPista
+ * Converte os 8 primeiros bytes do texto em um inteiro big-endian
+ * (completando com zeros). Comparar esses inteiros dá o mesmo resultado
+ * que strcmp nos 8 primeiros bytes, mas sem ler a string do nó.
+ */
+uint64_t prefixoPista(const char* texto) {
+    uint64_t valor = 0;
+    int i = 0;
+    for (; i < 8 && texto[i] != '\0'; i++) valor = (valor << 8) | (unsigned char)texto[i];
+    for (; i < 8; i++) valor <<= 8;
+    return valor;
+}
+
+/*
+ * Função: inserirPistaComPrefixo
+ * Inserção recursiva recebendo o prefixo já calculado. O strcmp só é
+ * usado quando os 8 primeiros bytes empatam.
+ */
+PistaNode* inserirPistaComPrefixo(PistaNode* raiz, char* conteudo, uint64_t prefixo) {
+    // Caso base: posição vazia encontrada, cria o nó aqui
+    if (raiz == NULL) {
+        PistaNode* novo = (PistaNode*)malloc(sizeof(PistaNode));
+        if (novo) {
+            strcpy(novo->conteudo, conteudo);
+            novo->prefixo = prefixo;
+            novo->esquerda = NULL;
+            novo->direita = NULL;
+        }
+        return novo;
+    }
+
+    // Compara alfabeticamente para decidir o lado (Esquerda < Raiz < Direita)
+    int cmp;
+    if (prefixo != raiz->prefixo) cmp = (prefixo < raiz->prefixo) ? -1 : 1;
+    else if ((prefixo & 0xFF) == 0) cmp = 0; // O texto terminou dentro do prefixo: iguais
+    else cmp = strcmp(conteudo + 8, raiz->conteudo + 8);
+
+    if (cmp < 0) {
+        raiz->esquerda = inserirPistaComPrefixo(raiz->esquerda, conteudo, prefixo);
+    } else if (cmp > 0) {
+        raiz->direita = inserirPistaComPrefixo(raiz->direita, conteudo, prefixo);
+    }
+    // Se cmp == 0, a pista é igual e já existe; ignoramos para não duplicar.
+
+    return raiz;
+}
+
+/*
+ * Função: inserirPista
+ * Insere uma string na BST. Se a pista já existe, não duplica.
+ * Retorna a raiz atualizada da subárvore.
+ */
+PistaNode* inserirPista(PistaNode* raiz, char* conteudo) {
+    return inserirPistaComPrefixo(raiz, conteudo, prefixoPista(conteudo));
+}
+
+void liberarPistas(PistaNode* raiz) {
+    if (raiz != NULL) {
+        liberarPistas(raiz->esquerda);
+        liberarPistas(raiz->direita);
+        free(raiz);
+    }
+}
+
+/*
+ * Função: iniciarEscritor
+ * Prepara o escritor. Esvazia antes o buffer do printf, para o relatório
+ * não sair antes do texto que já foi impresso.
+ */
+void iniciarEscritor(EscritorRelatorio* escritor, int fd, FormatoRelatorio formato) {
+    fflush(stdout);
+    escritor->fd = fd;
+    escritor->formato = formato;
+    escritor->usados = 0;
+    escritor->chamadasWrite = 0;
+    escritor->erro = false;
+}
+
+/*
+ * Função: descarregarEscritor
+ * Grava o conteúdo do buffer. Repete o write enquanto ele gravar só uma parte
+ * (comum em pipes) ou for interrompido por sinal. Retorna false em caso de erro.
+ */
+bool descarregarEscritor(EscritorRelatorio* escritor) {
+    size_t enviados = 0;
+    while (enviados < escritor->usados && !escritor->erro) {
+        long gravados = (long)write(escritor->fd, escritor->buffer + enviados, (unsigned)(escritor->usados - enviados));
+        escritor->chamadasWrite++;
+        if (gravados < 0) {
+            if (errno == EINTR) continue;
+            escritor->erro = true;
+        } else {
+            enviados += (size_t)gravados;
+        }
+    }
+    escritor->usados = 0;
+    return !escritor->erro;
+}
+
+// Auxiliar: copia bytes para o buffer, esvaziando-o quando enche
+void escreverBytes(EscritorRelatorio* escritor, const char* dados, size_t tam) {
+    while (tam > 0) {
+        if (escritor->usados == TAM_BUFFER_RELATORIO) descarregarEscritor(escritor);
+        size_t livre = TAM_BUFFER_RELATORIO - escritor->usados;
+        size_t parte = tam < livre ? tam : livre;
+        memcpy(escritor->buffer + escritor->usados, dados, parte);
+        escritor->usados += parte;
+        dados += parte;
+        tam -= parte;
+    }
+}
+
+// Auxiliar: texto como string JSON (aspas, barra e caracteres de controle escapados).
+// Bytes UTF-8 passam sem alteração.
+void escreverTextoJSON(EscritorRelatorio* escritor, const char* texto) {
+    static const char hex[] = "0123456789abcdef";
+    const char* inicio = texto;
+    for (; *texto != '\0'; texto++) {
+        unsigned char c = (unsigned char)*texto;
+        if (c != '"' && c != '\\' && c >= 0x20) continue;
+        escreverBytes(escritor, inicio, (size_t)(texto - inicio)); // Trecho sem escape de uma vez
+        char escape[6] = {'\\', (char)c, 0, 0, 0, 0};
+        size_t tamEscape = 2;
+        if (c < 0x20) {
+            escape[1] = 'u';
+            escape[2] = '0';
+            escape[3] = '0';
+            escape[4] = hex[c >> 4];
+            escape[5] = hex[c & 15];
+            tamEscape = 6;
+        }
+        escreverBytes(escritor, escape, tamEscape);
+        inicio = texto + 1;
+    }
+    escreverBytes(escritor, inicio, (size_t)(texto - inicio));
+}
+
+/*
+ * Função: escreverPistaRelatorio
+ * Grava uma pista no formato do escritor, sem passar pelo printf.
+ */
+void escreverPistaRelatorio(EscritorRelatorio* escritor, const char* pista) {
+    size_t tam = strlen(pista);
+    if (escritor->formato == FORMATO_TEXTO) {
+        escreverBytes(escritor, "- ", 2);
+        escreverBytes(escritor, pista, tam);
+        escreverBytes(escritor, "\n", 1);
+    } else if (escritor->formato == FORMATO_NDJSON) {
+        escreverBytes(escritor, "{\"pista\":\"", 10);
+        escreverTextoJSON(escritor, pista);
+        escreverBytes(escritor, "\"}\n", 3);
+    } else {
+        unsigned char prefixo[4] = {
+            (unsigned char)(tam & 0xFF), (unsigned char)((tam >> 8) & 0xFF),
+            (unsigned char)((tam >> 16) & 0xFF), (unsigned char)((tam >> 24) & 0xFF)
+        };
+        escreverBytes(escritor, (const char*)prefixo, 4);
+        escreverBytes(escritor, pista, tam);
+    }
+}
+
+/*
+ * Função: exibirPistas
+ * Realiza o percurso Em-Ordem (In-Order) na BST, enviando as pistas em ordem
+ * alfabética ao escritor. Quem chama decide quando descarregar o buffer.
+ */
+void exibirPistas(PistaNode* raiz, EscritorRelatorio* escritor) {
+    if (raiz != NULL) {
+        exibirPistas(raiz->esquerda, escritor);
+        escreverPistaRelatorio(escritor, raiz->conteudo);
+        exibirPistas(raiz->direita, escritor);
+    }
+}
+
+// Versão A: um fprintf por pista (o exibirPistas original escrevia em stdout)
+void exibirPistasPrintf(PistaNode* raiz, FILE* saida) {
+    if (raiz != NULL) {
+        exibirPistasPrintf(raiz->esquerda, saida);
+        fprintf(saida, "- %s\n", raiz->conteudo);
+        exibirPistasPrintf(raiz->direita, saida);
+    }
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+// Lê o arquivo temporário inteiro (para comparar as saídas A e B)
+char* lerArquivo(FILE* arquivo, long* tam) {
+    fflush(arquivo);
+    fseek(arquivo, 0, SEEK_END);
+    *tam = ftell(arquivo);
+    rewind(arquivo);
+    char* dados = (char*)malloc(*tam + 1);
+    if (dados == NULL || fread(dados, 1, *tam, arquivo) != (size_t)*tam) {
+        printf("Erro crítico: Falha na leitura do arquivo temporário.\n");
+        exit(1);
+    }
+    return dados;
+}
+
+int main(int argc, char* argv[]) {
+    int qtd = 2000000;
+    if (argc > 1 && atoi(argv[1]) > 0) qtd = atoi(argv[1]);
+
+    printf("========================================================\n");
+    printf("     RELATORIO DE PISTAS: printf vs ESCRITOR COM BUFFER\n");
+    printf("========================================================\n");
+
+    const char* objetos[] = {"Pegadas de lama", "Relógio parado", "Livro de \"venenos\"", "Taça quebrada",
+                             "Chave enferrujada", "Carta rasgada", "Luva manchada", "Vela apagada"};
+    srand(42);
+    PistaNode* raiz = NULL;
+    char texto[100];
+    for (int i = 0; i < qtd; i++) {
+        int n = aleatorio();
+        sprintf(texto, "%s no cômodo %d, registro %09d", objetos[n % 8], n % 500, n);
+        raiz = inserirPista(raiz, texto);
+    }
+    printf("Pistas na BST: %d (algumas com aspas e acentos)\n\n", qtd);
+
+    static EscritorRelatorio escritor;
+    const char* nomes[] = {"printf por pista", "Escritor (texto)", "Escritor (NDJSON)", "Escritor (tamanho)"};
+    char* saidaTexto[2] = {NULL, NULL};
+    long tamTexto[2] = {0, 0};
+
+    printf("%-20s %10s %10s %12s %10s\n", "", "Tempo (s)", "MB", "MB/s", "writes");
+    for (int versao = 0; versao < 4; versao++) {
+        FILE* arquivo = tmpfile();
+        if (arquivo == NULL) {
+            printf("[ERRO] Não foi possível criar o arquivo temporário.\n");
+            return 1;
+        }
+        long chamadas = 0;
+        clock_t inicio = clock();
+        if (versao == 0) {
+            exibirPistasPrintf(raiz, arquivo);
+            fflush(arquivo);
+        } else {
+            FormatoRelatorio formatos[] = {FORMATO_TEXTO, FORMATO_TEXTO, FORMATO_NDJSON, FORMATO_TAMANHO};
+            iniciarEscritor(&escritor, fileno(arquivo), formatos[versao]);
+            exibirPistas(raiz, &escritor);
+            descarregarEscritor(&escritor);
+            chamadas = escritor.chamadasWrite;
+        }
+        clock_t fim = clock();
+        double tempo = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+        long tam;
+        char* dados = lerArquivo(arquivo, &tam);
+        double mb = tam / (1024.0 * 1024.0);
+        if (versao == 0) printf("%-20s %10.3f %10.1f %12.1f %10s\n", nomes[versao], tempo, mb, mb / tempo, "-");
+        else printf("%-20s %10.3f %10.1f %12.1f %10ld\n", nomes[versao], tempo, mb, mb / tempo, chamadas);
+
+        if (versao < 2) {
+            saidaTexto[versao] = dados;
+            tamTexto[versao] = tam;
+        } else {
+            if (versao == 2) {
+                dados[tam] = '\0';
+                char* linha = strstr(dados, "venenos");
+                while (linha > dados && linha[-1] != '\n') linha--;
+                printf("%-20s %.*s", "  exemplo:", (int)(strchr(linha, '\n') - linha + 1), linha);
+            }
+            free(dados);
+        }
+        fclose(arquivo);
+    }
+
+    bool iguais = tamTexto[0] == tamTexto[1] && memcmp(saidaTexto[0], saidaTexto[1], tamTexto[0]) == 0;
+    printf("\nSaida em texto %s a do printf\n", iguais ? "IGUAL (byte a byte)" : "DIFERENTE (ERRO!)");
+
+    free(saidaTexto[0]);
+    free(saidaTexto[1]);
+    liberarPistas(raiz);
+    printf("\nFim do programa.\n");
+    return 0;
+}
@@ -7,11 +7,37 @@
  * Estruturas:
  *   1. Árvore Binária: Representa o mapa da mansão (Salas).
  *   2. BST (Binary Search Tree): Armazena as pistas coletadas em ordem alfabética.
+ *   3. Vetor de coleta (modo adiado): guarda só referências às pistas durante
+ *      a exploração e ordena/remove repetidas uma única vez, no relatório.
+ *   4. Conjunto de digitais (hash de 64 bits): descarta pistas repetidas
+ *      antes de descer a BST.
+ *   5. Índice de pistas por caminho: um bitset por sala com as pistas da
+ *      entrada até ela; "o que esta rota me dá" vira leitura + popcount.
+ *
+ * O relatório final passa por um escritor com buffer (poucas chamadas a
+ * write) e pode sair como texto, NDJSON ou registros com prefixo de tamanho.
+ * Em NDJSON e binário, o stdout recebe só os registros; menus e mensagens
+ * do jogo vão para o stderr.
+ *
+ * Uso: ./Detective_Quest_Pistas [--adiado] [--ndjson | --binario] [--rota eed...]
+ *      --rota: mostra as pistas do caminho (e = esquerda, d = direita) sem jogar.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#ifdef _WIN32
+#include <io.h>
+#define write _write // MSYS2/ucrt: mesmas funções com outro nome
+#define dup _dup
+#define dup2 _dup2
+#define close _close
+#else
+#include <unistd.h>
+#endif
 
 // ============================================================================
 // DEFINIÇÃO DAS ESTRUTURAS
@@ -20,9 +46,10 @@
 // Estrutura para a Árvore de Pistas (BST)
 // Armazena o texto da pista e ponteiros para ordenação.
 typedef struct PistaNode {
-    char conteudo[100];
+    uint64_t prefixo;              // 8 primeiros bytes do conteúdo (big-endian), comparados antes do strcmp
     struct PistaNode* esquerda;
     struct PistaNode* direita;
+    char conteudo[100];
 } PistaNode;
 
 // Estrutura para a Árvore da Mansão (Mapa)
@@ -32,8 +59,61 @@ typedef struct Sala {
     char pista[100];        // Pista associada ao cômodo (pode ser vazia)
     struct Sala* esquerda;  // Caminho à esquerda
     struct Sala* direita;   // Caminho à direita
+    uint64_t* pistasCaminho; // Bitset do IndicePistas (NULL até o índice ser montado)
 } Sala;
 
+// Conjunto de digitais das pistas que já estão na BST (endereçamento aberto,
+// sondagem linear). Revisitar uma sala custa um hash e uma ou duas leituras,
+// em vez de descer a árvore inteira comparando textos.
+typedef struct {
+    uint64_t* digitais;     // 0 = posição vazia
+    const char** textos;    // Texto de cada digital, para confirmar colisões
+    int capacidade;         // Sempre potência de 2
+    int qtd;
+} ConjuntoDigitais;
+
+// Vetor de pistas para o modo de coleta adiada.
+// Cada visita só acrescenta um ponteiro para o texto da pista da sala (sem
+// malloc por pista e sem strcmp); a ordenação acontece uma vez, quando a
+// lista é exibida. Revisitas à mesma sala são descartadas pelo endereço do
+// texto, então o vetor nunca passa do número de salas com pista.
+typedef struct {
+    const char** itens;     // Referências às pistas das salas (não são cópias)
+    int qtd;
+    int capacidade;
+    bool ordenada;          // true = ordem alfabética e sem repetidas (após consolidar)
+    ConjuntoDigitais enderecos; // Endereços já registrados (chave = ponteiro, sem ler o texto)
+} ColetaPistas;
+
+// Escritor de relatórios: acumula a saída em um buffer grande e só chama
+// write() quando ele enche (em vez de um printf por pista).
+#define TAM_BUFFER_RELATORIO (64 * 1024)
+
+typedef enum {
+    FORMATO_TEXTO,   // "- pista\n" (mesmo texto do printf original)
+    FORMATO_NDJSON,  // {"pista":"..."} por linha
+    FORMATO_TAMANHO  // 4 bytes little-endian com o tamanho + bytes da pista
+} FormatoRelatorio;
+
+typedef struct {
+    int fd;                  // Descritor de saída (1 = stdout)
+    FormatoRelatorio formato;
+    size_t usados;           // Bytes ocupados no buffer
+    long chamadasWrite;
+    bool erro;
+    char buffer[TAM_BUFFER_RELATORIO];
+} EscritorRelatorio;
+
+// Índice de pistas por caminho. Cada pista distinta do mapa recebe um ID
+// (na ordem alfabética) e cada sala recebe um bitset com as pistas do
+// caminho da entrada até ela (a sua e as de todas as salas acima).
+typedef struct {
+    const char** textos;    // textos[id], em ordem alfabética
+    int qtdPistas;
+    int palavras;           // uint64_t por bitset
+    uint64_t* bits;         // Bitsets de todas as salas, um após o outro
+} IndicePistas;
+
 // ============================================================================
 // PROTÓTIPOS DAS FUNÇÕES
 // ============================================================================
@@ -44,11 +124,40 @@ Sala* criarSala(char* nome, char* pista);
 // Insere uma nova pista na árvore BST, mantendo a ordem alfabética.
 PistaNode* inserirPista(PistaNode* raiz, char* conteudo);
 
+// Conjunto de digitais: registrarDigital retorna false se a pista já foi vista.
+// registrarEndereco faz o mesmo comparando só o endereço do texto.
+void iniciarDigitais(ConjuntoDigitais* conjunto);
+bool registrarDigital(ConjuntoDigitais* conjunto, const char* pista);
+bool registrarEndereco(ConjuntoDigitais* conjunto, const char* pista);
+void liberarDigitais(ConjuntoDigitais* conjunto);
+
 // Controla a navegação entre salas e a coleta automática de pistas.
-void explorarSalasComPistas(Sala* mapa, PistaNode** raizPistas);
+// Se coleta != NULL, usa o modo adiado em vez de inserir na BST.
+// Se vistas != NULL, pistas repetidas são descartadas antes do inserirPista.
+void explorarSalasComPistas(Sala* mapa, PistaNode** raizPistas, ConjuntoDigitais* vistas, ColetaPistas* coleta);
+
+// Escritor de relatórios: prepara, grava uma pista e esvazia o buffer.
+void iniciarEscritor(EscritorRelatorio* escritor, int fd, FormatoRelatorio formato);
+void escreverPistaRelatorio(EscritorRelatorio* escritor, const char* pista);
+bool descarregarEscritor(EscritorRelatorio* escritor);
 
-// Imprime a árvore de pistas em ordem alfabética (Percurso Em-Ordem).
-void exibirPistas(PistaNode* raiz);
+// Envia a árvore de pistas em ordem alfabética (Percurso Em-Ordem) ao escritor.
+void exibirPistas(PistaNode* raiz, EscritorRelatorio* escritor);
+
+// Modo adiado: registra, ordena/remove repetidas e imprime as pistas.
+void iniciarColeta(ColetaPistas* coleta);
+void registrarPista(ColetaPistas* coleta, const char* pista);
+void consolidarColeta(ColetaPistas* coleta);
+void exibirColeta(ColetaPistas* coleta, EscritorRelatorio* escritor);
+void liberarColeta(ColetaPistas* coleta);
+
+// Índice de pistas por caminho: montado uma vez, depois cada consulta é
+// uma leitura de bitset (contagem com popcount).
+void prepararIndicePistas(Sala* mansao, IndicePistas* indice);
+Sala* salaDaRota(Sala* mansao, const char* rota);
+int contarPistasCaminho(IndicePistas* indice, Sala* sala);
+void exibirPistasCaminho(IndicePistas* indice, Sala* sala, EscritorRelatorio* escritor);
+void liberarIndicePistas(IndicePistas* indice);
 
 // Funções auxiliares para liberar memória.
 void liberarMapa(Sala* raiz);
@@ -58,7 +167,29 @@ void liberarPistas(PistaNode* raiz);
 // FUNÇÃO PRINCIPAL
 // ============================================================================
 
-int main() {
+int main(int argc, char* argv[]) {
+    bool modoAdiado = false;
+    FormatoRelatorio formato = FORMATO_TEXTO;
+    const char* rota = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--adiado") == 0) modoAdiado = true;
+        else if (strcmp(argv[i], "--ndjson") == 0) formato = FORMATO_NDJSON;
+        else if (strcmp(argv[i], "--binario") == 0) formato = FORMATO_TAMANHO;
+        else if (strcmp(argv[i], "--rota") == 0 && i + 1 < argc) rota = argv[++i];
+    }
+
+    // NDJSON e binário: os registros ficam com uma cópia do stdout original e
+    // o descritor 1 passa a apontar para o stderr, então todo printf do jogo
+    // (menus, banners, avisos) sai do fluxo que será lido por outro programa.
+    int fdRegistros = 1;
+    if (formato != FORMATO_TEXTO) {
+        fdRegistros = dup(1);
+        if (fdRegistros < 0 || dup2(2, 1) < 0) {
+            fprintf(stderr, "[ERRO] Não foi possível separar os registros do texto do jogo.\n");
+            return 1;
+        }
+    }
+
     // 1. Construção do Mapa da Mansão (Árvore Binária Fixa)
     // Nível 0: Raiz
     Sala* mansao = criarSala("Hall de Entrada", "Pegadas de lama no chão");
@@ -75,8 +206,34 @@ int main() {
     mansao->direita->esquerda = criarSala("Sala de Jantar", "Taça de vinho quebrada");
     mansao->direita->direita = criarSala("Porão", "Chave enferrujada antiga");
 
+    // Consulta de rota: responde pelo índice, sem explorar nem montar a BST
+    if (rota != NULL) {
+        IndicePistas indice;
+        prepararIndicePistas(mansao, &indice);
+        Sala* destino = salaDaRota(mansao, rota);
+        int status = (destino == NULL); // Calculado antes de liberar o mapa
+        if (destino == NULL) {
+            printf("[!] Rota \"%s\" inválida para este mapa.\n", rota);
+        } else {
+            printf("Rota \"%s\" termina em %s e coleta %d pista(s):\n\n", rota, destino->nome,
+                   contarPistasCaminho(&indice, destino));
+            static EscritorRelatorio escritorRota;
+            iniciarEscritor(&escritorRota, fdRegistros, formato);
+            exibirPistasCaminho(&indice, destino, &escritorRota);
+            descarregarEscritor(&escritorRota);
+        }
+        liberarIndicePistas(&indice);
+        liberarMapa(mansao);
+        if (fdRegistros != 1) close(fdRegistros);
+        return status;
+    }
+
     // 2. Inicialização da Árvore de Pistas (Inventário vazio)
     PistaNode* inventarioPistas = NULL;
+    ConjuntoDigitais pistasVistas;
+    iniciarDigitais(&pistasVistas);
+    ColetaPistas coleta;
+    iniciarColeta(&coleta);
 
     printf("=========================================\n");
     printf("      DETECTIVE QUEST: CAÇA ÀS PISTAS    \n");
@@ -85,7 +242,7 @@ int main() {
 
     // 3. Início da Exploração
     // Passamos o endereço do ponteiro inventarioPistas para poder modificá-lo
-    explorarSalasComPistas(mansao, &inventarioPistas);
+    explorarSalasComPistas(mansao, &inventarioPistas, &pistasVistas, modoAdiado ? &coleta : NULL);
 
     // 4. Relatório Final
     printf("\n=========================================\n");
@@ -93,16 +250,24 @@ int main() {
     printf("=========================================\n");
     printf("Pistas coletadas (Ordem Alfabética):\n\n");
     
-    if (inventarioPistas == NULL) {
+    if (inventarioPistas == NULL && coleta.qtd == 0) {
         printf("- Nenhuma pista foi coletada.\n");
     } else {
-        exibirPistas(inventarioPistas);
+        // static: o buffer de 64 KB não precisa ficar na pilha
+        static EscritorRelatorio escritor;
+        iniciarEscritor(&escritor, fdRegistros, formato);
+        if (modoAdiado) exibirColeta(&coleta, &escritor);
+        else exibirPistas(inventarioPistas, &escritor);
+        descarregarEscritor(&escritor);
     }
     printf("=========================================\n");
 
     // 5. Limpeza de Memória
     liberarMapa(mansao);
     liberarPistas(inventarioPistas);
+    liberarDigitais(&pistasVistas);
+    liberarColeta(&coleta);
+    if (fdRegistros != 1) close(fdRegistros);
     printf("\nMemória liberada. Caso encerrado.\n");
 
     return 0;
@@ -133,20 +298,36 @@ Sala* criarSala(char* nome, char* pista) {
     
     nova->esquerda = NULL;
     nova->direita = NULL;
+    nova->pistasCaminho = NULL;
     return nova;
 }
 
 /*
- * Função: inserirPista
- * Insere uma string na BST. Se a pista já existe, não duplica.
- * Retorna a raiz atualizada da subárvore.
+ * Função: prefixoPista
+ * Converte os 8 primeiros bytes do texto em um inteiro big-endian
+ * (completando com zeros). Comparar esses inteiros dá o mesmo resultado
+ * que strcmp nos 8 primeiros bytes, mas sem ler a string do nó.
  */
-PistaNode* inserirPista(PistaNode* raiz, char* conteudo) {
+uint64_t prefixoPista(const char* texto) {
+    uint64_t valor = 0;
+    int i = 0;
+    for (; i < 8 && texto[i] != '\0'; i++) valor = (valor << 8) | (unsigned char)texto[i];
+    for (; i < 8; i++) valor <<= 8;
+    return valor;
+}
+
+/*
+ * Função: inserirPistaComPrefixo
+ * Inserção recursiva recebendo o prefixo já calculado. O strcmp só é
+ * usado quando os 8 primeiros bytes empatam.
+ */
+PistaNode* inserirPistaComPrefixo(PistaNode* raiz, char* conteudo, uint64_t prefixo) {
     // Caso base: posição vazia encontrada, cria o nó aqui
     if (raiz == NULL) {
         PistaNode* novo = (PistaNode*)malloc(sizeof(PistaNode));
         if (novo) {
             strcpy(novo->conteudo, conteudo);
+            novo->prefixo = prefixo;
             novo->esquerda = NULL;
             novo->direita = NULL;
         }
@@ -154,24 +335,231 @@ PistaNode* inserirPista(PistaNode* raiz, char* conteudo) {
     }
 
     // Compara alfabeticamente para decidir o lado (Esquerda < Raiz < Direita)
-    int cmp = strcmp(conteudo, raiz->conteudo);
+    int cmp;
+    if (prefixo != raiz->prefixo) cmp = (prefixo < raiz->prefixo) ? -1 : 1;
+    else if ((prefixo & 0xFF) == 0) cmp = 0; // O texto terminou dentro do prefixo: iguais
+    else cmp = strcmp(conteudo + 8, raiz->conteudo + 8);
 
     if (cmp < 0) {
-        raiz->esquerda = inserirPista(raiz->esquerda, conteudo);
+        raiz->esquerda = inserirPistaComPrefixo(raiz->esquerda, conteudo, prefixo);
     } else if (cmp > 0) {
-        raiz->direita = inserirPista(raiz->direita, conteudo);
+        raiz->direita = inserirPistaComPrefixo(raiz->direita, conteudo, prefixo);
     }
     // Se cmp == 0, a pista é igual e já existe; ignoramos para não duplicar.
 
     return raiz;
 }
 
+/*
+ * Função: inserirPista
+ * Insere uma string na BST. Se a pista já existe, não duplica.
+ * Retorna a raiz atualizada da subárvore.
+ */
+PistaNode* inserirPista(PistaNode* raiz, char* conteudo) {
+    return inserirPistaComPrefixo(raiz, conteudo, prefixoPista(conteudo));
+}
+
+/*
+ * Função: iniciarDigitais
+ * Prepara um conjunto vazio (a tabela só é alocada no primeiro registro).
+ */
+void iniciarDigitais(ConjuntoDigitais* conjunto) {
+    conjunto->digitais = NULL;
+    conjunto->textos = NULL;
+    conjunto->capacidade = 0;
+    conjunto->qtd = 0;
+}
+
+/*
+ * Função: digitalPista
+ * Hash FNV-1a de 64 bits do texto. O valor 0 marca posição vazia na
+ * tabela, então é trocado por 1.
+ */
+uint64_t digitalPista(const char* texto) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const unsigned char* c = (const unsigned char*)texto; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    return hash ? hash : 1;
+}
+
+// Auxiliar: coloca a digital na primeira posição vazia (sem verificar repetidas)
+void posicionarDigital(ConjuntoDigitais* conjunto, uint64_t digital, const char* texto) {
+    int mascara = conjunto->capacidade - 1;
+    int pos = (int)(digital & mascara);
+    while (conjunto->digitais[pos] != 0) pos = (pos + 1) & mascara;
+    conjunto->digitais[pos] = digital;
+    conjunto->textos[pos] = texto;
+}
+
+// Auxiliar: dobra a tabela e reposiciona as digitais (sem recalcular o hash)
+void crescerDigitais(ConjuntoDigitais* conjunto) {
+    ConjuntoDigitais antigo = *conjunto;
+    conjunto->capacidade = antigo.capacidade ? antigo.capacidade * 2 : 64;
+    conjunto->digitais = (uint64_t*)calloc(conjunto->capacidade, sizeof(uint64_t));
+    conjunto->textos = (const char**)malloc(conjunto->capacidade * sizeof(const char*));
+    if (conjunto->digitais == NULL || conjunto->textos == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (int i = 0; i < antigo.capacidade; i++) {
+        if (antigo.digitais[i] != 0) posicionarDigital(conjunto, antigo.digitais[i], antigo.textos[i]);
+    }
+    free(antigo.digitais);
+    free(antigo.textos);
+}
+
+/*
+ * Função: registrarDigital
+ * Retorna true se a pista é nova (e a registra) ou false se já foi vista.
+ * Digitais iguais com textos diferentes (colisão) são resolvidas com strcmp,
+ * então nenhuma pista é descartada por engano. O texto não é copiado: a
+ * sala precisa existir enquanto o conjunto existir.
+ */
+bool registrarDigital(ConjuntoDigitais* conjunto, const char* pista) {
+    // Mantém a ocupação abaixo de 70% para as sondagens continuarem curtas
+    if ((conjunto->qtd + 1) * 10 > conjunto->capacidade * 7) crescerDigitais(conjunto);
+
+    uint64_t digital = digitalPista(pista);
+    int mascara = conjunto->capacidade - 1;
+    int pos = (int)(digital & mascara);
+    while (conjunto->digitais[pos] != 0) {
+        if (conjunto->digitais[pos] == digital &&
+            (conjunto->textos[pos] == pista || strcmp(conjunto->textos[pos], pista) == 0)) {
+            return false; // Já vista
+        }
+        pos = (pos + 1) & mascara;
+    }
+    conjunto->digitais[pos] = digital;
+    conjunto->textos[pos] = pista;
+    conjunto->qtd++;
+    return true;
+}
+
+/*
+ * Função: registrarEndereco
+ * Como registrarDigital, mas a chave é o endereço do texto: a mesma sala
+ * sempre passa o mesmo ponteiro, então nenhum texto é lido. Salas
+ * diferentes com o mesmo texto contam como pistas distintas aqui.
+ */
+bool registrarEndereco(ConjuntoDigitais* conjunto, const char* pista) {
+    if ((conjunto->qtd + 1) * 10 > conjunto->capacidade * 7) crescerDigitais(conjunto);
+
+    // Mistura do splitmix64: endereços próximos caem em posições distantes
+    uint64_t digital = (uint64_t)(uintptr_t)pista;
+    digital = (digital ^ (digital >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    digital = (digital ^ (digital >> 27)) * 0x94D049BB133111EBULL;
+    digital ^= digital >> 31;
+    if (digital == 0) digital = 1;
+
+    int mascara = conjunto->capacidade - 1;
+    int pos = (int)(digital & mascara);
+    while (conjunto->digitais[pos] != 0) {
+        if (conjunto->textos[pos] == pista) return false; // Já registrado
+        pos = (pos + 1) & mascara;
+    }
+    conjunto->digitais[pos] = digital;
+    conjunto->textos[pos] = pista;
+    conjunto->qtd++;
+    return true;
+}
+
+void liberarDigitais(ConjuntoDigitais* conjunto) {
+    free(conjunto->digitais);
+    free(conjunto->textos);
+    iniciarDigitais(conjunto);
+}
+
+/*
+ * Função: iniciarColeta
+ * Prepara um vetor de coleta vazio (a memória só é alocada no primeiro registro).
+ */
+void iniciarColeta(ColetaPistas* coleta) {
+    coleta->itens = NULL;
+    coleta->qtd = 0;
+    coleta->capacidade = 0;
+    coleta->ordenada = true; // Vetor vazio já está consolidado
+    iniciarDigitais(&coleta->enderecos);
+}
+
+/*
+ * Função: registrarPista
+ * Acrescenta a referência da pista ao fim do vetor: O(1) amortizado.
+ * Uma sala já registrada é ignorada (um hash do endereço, sem strcmp).
+ * O texto não é copiado, então a sala precisa existir até o relatório.
+ */
+void registrarPista(ColetaPistas* coleta, const char* pista) {
+    if (!registrarEndereco(&coleta->enderecos, pista)) return;
+    if (coleta->qtd == coleta->capacidade) {
+        int novaCapacidade = coleta->capacidade ? coleta->capacidade * 2 : 64;
+        const char** novos = (const char**)realloc(coleta->itens, novaCapacidade * sizeof(const char*));
+        if (novos == NULL) {
+            printf("Erro crítico: Falha na alocação de memória.\n");
+            exit(1);
+        }
+        coleta->itens = novos;
+        coleta->capacidade = novaCapacidade;
+    }
+    coleta->itens[coleta->qtd++] = pista;
+    coleta->ordenada = false;
+}
+
+// Auxiliar do qsort: ordem alfabética (a mesma do strcmp usado na BST)
+int compararTextos(const void* a, const void* b) {
+    const char* pa = *(const char* const*)a;
+    const char* pb = *(const char* const*)b;
+    if (pa == pb) return 0;
+    return strcmp(pa, pb);
+}
+
+// Auxiliar: ordena com 'comparar' e mantém só o primeiro de cada grupo igual
+void ordenarSemRepetidas(ColetaPistas* coleta, int (*comparar)(const void*, const void*)) {
+    qsort(coleta->itens, coleta->qtd, sizeof(const char*), comparar);
+    int total = 0;
+    for (int i = 0; i < coleta->qtd; i++) {
+        if (total == 0 || comparar(&coleta->itens[total - 1], &coleta->itens[i]) != 0) {
+            coleta->itens[total++] = coleta->itens[i];
+        }
+    }
+    coleta->qtd = total;
+}
+
+/*
+ * Função: consolidarColeta
+ * Ordena alfabeticamente e remove pistas repetidas. Chamada no relatório.
+ */
+void consolidarColeta(ColetaPistas* coleta) {
+    if (coleta->ordenada) return;
+    ordenarSemRepetidas(coleta, compararTextos);
+    coleta->ordenada = true;
+}
+
+/*
+ * Função: exibirColeta
+ * Equivalente ao exibirPistas para o modo adiado: consolida e envia ao escritor.
+ */
+void exibirColeta(ColetaPistas* coleta, EscritorRelatorio* escritor) {
+    consolidarColeta(coleta);
+    for (int i = 0; i < coleta->qtd; i++) {
+        escreverPistaRelatorio(escritor, coleta->itens[i]);
+    }
+}
+
+void liberarColeta(ColetaPistas* coleta) {
+    free(coleta->itens);
+    liberarDigitais(&coleta->enderecos);
+    iniciarColeta(coleta);
+}
+
 /*
  * Função: explorarSalasComPistas
  * Loop principal de navegação.
  * Parâmetro raizPistas é um ponteiro duplo para permitir alterar a raiz da BST.
+ * Se coleta não for NULL, as pistas vão para o vetor (modo adiado).
+ * Se vistas não for NULL, só pistas novas chegam ao inserirPista.
  */
-void explorarSalasComPistas(Sala* salaAtual, PistaNode** raizPistas) {
+void explorarSalasComPistas(Sala* salaAtual, PistaNode** raizPistas, ConjuntoDigitais* vistas, ColetaPistas* coleta) {
     char opcao;
     
     while (salaAtual != NULL) {
@@ -183,8 +571,12 @@ void explorarSalasComPistas(Sala* salaAtual, PistaNode** raizPistas) {
             printf("[!] Pista encontrada: \"%s\"\n", salaAtual->pista);
             printf("    -> Adicionando ao caderno de anotações...\n");
             
-            // Insere na BST usando o ponteiro dereferenciado (*raizPistas)
-            *raizPistas = inserirPista(*raizPistas, salaAtual->pista);
+            if (coleta != NULL) {
+                registrarPista(coleta, salaAtual->pista);
+            } else if (vistas == NULL || registrarDigital(vistas, salaAtual->pista)) {
+                // Insere na BST usando o ponteiro dereferenciado (*raizPistas)
+                *raizPistas = inserirPista(*raizPistas, salaAtual->pista);
+            }
         } else {
             printf("(Nenhuma pista visível neste cômodo)\n");
         }
@@ -231,16 +623,231 @@ void explorarSalasComPistas(Sala* salaAtual, PistaNode** raizPistas) {
     }
 }
 
+/*
+ * Função: iniciarEscritor
+ * Prepara o escritor. Esvazia antes o buffer do printf, para o relatório
+ * não sair antes do texto que já foi impresso.
+ */
+void iniciarEscritor(EscritorRelatorio* escritor, int fd, FormatoRelatorio formato) {
+    fflush(stdout);
+    escritor->fd = fd;
+    escritor->formato = formato;
+    escritor->usados = 0;
+    escritor->chamadasWrite = 0;
+    escritor->erro = false;
+}
+
+/*
+ * Função: descarregarEscritor
+ * Grava o conteúdo do buffer. Repete o write enquanto ele gravar só uma parte
+ * (comum em pipes) ou for interrompido por sinal. Retorna false em caso de erro.
+ */
+bool descarregarEscritor(EscritorRelatorio* escritor) {
+    size_t enviados = 0;
+    while (enviados < escritor->usados && !escritor->erro) {
+        long gravados = (long)write(escritor->fd, escritor->buffer + enviados, (unsigned)(escritor->usados - enviados));
+        escritor->chamadasWrite++;
+        if (gravados < 0) {
+            if (errno == EINTR) continue;
+            escritor->erro = true;
+        } else {
+            enviados += (size_t)gravados;
+        }
+    }
+    escritor->usados = 0;
+    return !escritor->erro;
+}
+
+// Auxiliar: copia bytes para o buffer, esvaziando-o quando enche
+void escreverBytes(EscritorRelatorio* escritor, const char* dados, size_t tam) {
+    while (tam > 0) {
+        if (escritor->usados == TAM_BUFFER_RELATORIO) descarregarEscritor(escritor);
+        size_t livre = TAM_BUFFER_RELATORIO - escritor->usados;
+        size_t parte = tam < livre ? tam : livre;
+        memcpy(escritor->buffer + escritor->usados, dados, parte);
+        escritor->usados += parte;
+        dados += parte;
+        tam -= parte;
+    }
+}
+
+// Auxiliar: texto como string JSON (aspas, barra e caracteres de controle escapados).
+// Bytes UTF-8 passam sem alteração.
+void escreverTextoJSON(EscritorRelatorio* escritor, const char* texto) {
+    static const char hex[] = "0123456789abcdef";
+    const char* inicio = texto;
+    for (; *texto != '\0'; texto++) {
+        unsigned char c = (unsigned char)*texto;
+        if (c != '"' && c != '\\' && c >= 0x20) continue;
+        escreverBytes(escritor, inicio, (size_t)(texto - inicio)); // Trecho sem escape de uma vez
+        char escape[6] = {'\\', (char)c, 0, 0, 0, 0};
+        size_t tamEscape = 2;
+        if (c < 0x20) {
+            escape[1] = 'u';
+            escape[2] = '0';
+            escape[3] = '0';
+            escape[4] = hex[c >> 4];
+            escape[5] = hex[c & 15];
+            tamEscape = 6;
+        }
+        escreverBytes(escritor, escape, tamEscape);
+        inicio = texto + 1;
+    }
+    escreverBytes(escritor, inicio, (size_t)(texto - inicio));
+}
+
+/*
+ * Função: escreverPistaRelatorio
+ * Grava uma pista no formato do escritor, sem passar pelo printf.
+ */
+void escreverPistaRelatorio(EscritorRelatorio* escritor, const char* pista) {
+    size_t tam = strlen(pista);
+    if (escritor->formato == FORMATO_TEXTO) {
+        escreverBytes(escritor, "- ", 2);
+        escreverBytes(escritor, pista, tam);
+        escreverBytes(escritor, "\n", 1);
+    } else if (escritor->formato == FORMATO_NDJSON) {
+        escreverBytes(escritor, "{\"pista\":\"", 10);
+        escreverTextoJSON(escritor, pista);
+        escreverBytes(escritor, "\"}\n", 3);
+    } else {
+        unsigned char prefixo[4] = {
+            (unsigned char)(tam & 0xFF), (unsigned char)((tam >> 8) & 0xFF),
+            (unsigned char)((tam >> 16) & 0xFF), (unsigned char)((tam >> 24) & 0xFF)
+        };
+        escreverBytes(escritor, (const char*)prefixo, 4);
+        escreverBytes(escritor, pista, tam);
+    }
+}
+
 /*
  * Função: exibirPistas
- * Realiza o percurso Em-Ordem (In-Order) na BST para imprimir alfabeticamente.
+ * Realiza o percurso Em-Ordem (In-Order) na BST, enviando as pistas em ordem
+ * alfabética ao escritor. Quem chama decide quando descarregar o buffer.
  */
-void exibirPistas(PistaNode* raiz) {
+void exibirPistas(PistaNode* raiz, EscritorRelatorio* escritor) {
     if (raiz != NULL) {
-        exibirPistas(raiz->esquerda);
-        printf("- %s\n", raiz->conteudo);
-        exibirPistas(raiz->direita);
+        exibirPistas(raiz->esquerda, escritor);
+        escreverPistaRelatorio(escritor, raiz->conteudo);
+        exibirPistas(raiz->direita, escritor);
+    }
+}
+
+// Auxiliar: registra as pistas de todas as salas e conta as salas
+void coletarPistasMapa(Sala* sala, ColetaPistas* coleta, int* qtdSalas) {
+    if (sala == NULL) return;
+    (*qtdSalas)++;
+    if (sala->pista[0] != '\0') registrarPista(coleta, sala->pista);
+    coletarPistasMapa(sala->esquerda, coleta, qtdSalas);
+    coletarPistasMapa(sala->direita, coleta, qtdSalas);
+}
+
+// Auxiliar: ID de uma pista (busca binária nos textos ordenados)
+int idPista(IndicePistas* indice, const char* texto) {
+    const char** achado = (const char**)bsearch(&texto, indice->textos, indice->qtdPistas,
+                                                sizeof(const char*), compararTextos);
+    return (int)(achado - indice->textos);
+}
+
+// Auxiliar: bitset da sala = bitset do pai + bit da própria pista
+void preencherCaminhos(Sala* sala, const uint64_t* doPai, IndicePistas* indice, int* proximo) {
+    if (sala == NULL) return;
+    uint64_t* bits = indice->bits + (size_t)(*proximo)++ * indice->palavras;
+    if (doPai != NULL) memcpy(bits, doPai, indice->palavras * sizeof(uint64_t));
+    if (sala->pista[0] != '\0') {
+        int id = idPista(indice, sala->pista);
+        bits[id / 64] |= 1ULL << (id % 64);
+    }
+    sala->pistasCaminho = bits;
+    preencherCaminhos(sala->esquerda, bits, indice, proximo);
+    preencherCaminhos(sala->direita, bits, indice, proximo);
+}
+
+/*
+ * Função: prepararIndicePistas
+ * Pré-processamento: dá um ID a cada pista distinta (ordem alfabética, a
+ * mesma da BST) e monta o bitset do caminho de cada sala, de cima para baixo.
+ * Custa O(salas * pistas / 64) de memória; o mapa não deve mudar depois.
+ */
+void prepararIndicePistas(Sala* mansao, IndicePistas* indice) {
+    ColetaPistas coleta;
+    iniciarColeta(&coleta);
+    int qtdSalas = 0;
+    coletarPistasMapa(mansao, &coleta, &qtdSalas);
+    consolidarColeta(&coleta);
+    liberarDigitais(&coleta.enderecos); // Só o vetor continua em uso
+
+    // O vetor da coleta passa a ser a tabela de textos do índice
+    indice->textos = coleta.itens;
+    indice->qtdPistas = coleta.qtd;
+    indice->palavras = coleta.qtd > 0 ? (coleta.qtd + 63) / 64 : 1;
+    indice->bits = (uint64_t*)calloc((size_t)qtdSalas * indice->palavras, sizeof(uint64_t));
+    if (indice->bits == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    int proximo = 0;
+    preencherCaminhos(mansao, NULL, indice, &proximo);
+}
+
+/*
+ * Função: salaDaRota
+ * Segue a rota a partir da entrada ('e' = esquerda, 'd' = direita).
+ * Retorna NULL se a rota tiver outro caractere ou sair do mapa.
+ */
+Sala* salaDaRota(Sala* mansao, const char* rota) {
+    Sala* atual = mansao;
+    for (const char* c = rota; *c != '\0' && atual != NULL; c++) {
+        if (*c == 'e' || *c == 'E') atual = atual->esquerda;
+        else if (*c == 'd' || *c == 'D') atual = atual->direita;
+        else return NULL;
     }
+    return atual;
+}
+
+/*
+ * Função: contarPistasCaminho
+ * Quantas pistas distintas o caminho até a sala coleta: popcount do bitset.
+ */
+int contarPistasCaminho(IndicePistas* indice, Sala* sala) {
+    int total = 0;
+    for (int i = 0; i < indice->palavras; i++) {
+#if defined(__GNUC__)
+        total += __builtin_popcountll(sala->pistasCaminho[i]);
+#else
+        uint64_t x = sala->pistasCaminho[i];
+        while (x) { x &= x - 1; total++; }
+#endif
+    }
+    return total;
+}
+
+/*
+ * Função: exibirPistasCaminho
+ * Envia ao escritor as pistas do caminho até a sala. Os IDs seguem a ordem
+ * alfabética, então percorrer os bits já dá a mesma lista do exibirPistas.
+ */
+void exibirPistasCaminho(IndicePistas* indice, Sala* sala, EscritorRelatorio* escritor) {
+    for (int i = 0; i < indice->palavras; i++) {
+        uint64_t x = sala->pistasCaminho[i];
+        while (x) {
+#if defined(__GNUC__)
+            int bit = __builtin_ctzll(x);
+#else
+            int bit = 0;
+            while (!((x >> bit) & 1)) bit++;
+#endif
+            escreverPistaRelatorio(escritor, indice->textos[i * 64 + bit]);
+            x &= x - 1;
+        }
+    }
+}
+
+void liberarIndicePistas(IndicePistas* indice) {
+    free(indice->textos);
+    free(indice->bits);
+    indice->textos = NULL;
+    indice->bits = NULL;
 }
 
 /*
@@ -0,0 +1,531 @@
+/*
+ * Objetivo: Motor de sessões do Detective Quest: um único mapa da mansão,
+ *           somente leitura, compartilhado por milhares de jogadores ao mesmo
+ *           tempo (o Detective_Quest_Pistas.c monta uma mansão por jogador).
+ *
+ * Estrutura:
+ * 1. Mapa compartilhado: as salas são criadas uma vez e depois só lidas
+ *    (const). Cada pista distinta recebe um ID (ordem alfabética) e a sala
+ *    guarda o ID da sua pista, então nenhuma thread compara textos.
+ * 2. Sessão: só a posição do jogador, contadores e um bitset com as pistas
+ *    coletadas (qtdPistas / 64 palavras de 8 bytes por jogador).
+ * 3. Pool de threads: cada trabalhadora é dona de uma faixa contínua de
+ *    sessões (sessao / ceil(sessoes / qtdThreads) == id dela), então
+ *    sessões vizinhas na memória (a mesma linha de cache) ficam com a mesma
+ *    thread e nenhuma linha é disputada a cada passo. O fluxo de comandos
+ *    é dividido em lotes por trabalhadora, então os comandos de uma sessão
+ *    são aplicados em ordem e nenhuma sessão precisa de trava. Os lotes
+ *    voltam vazios para o produtor (fila de livres), o que limita a memória
+ *    e o atraso da fila.
+ *
+ * Comandos: 'e' (esquerda), 'd' (direita) e 's' (sair: a sessão termina e
+ * o jogador recomeça do Hall de Entrada com o caderno vazio).
+ *
+ * Métricas: comandos por segundo, tempo de serviço por passo e latência de
+ * cada comando (da entrada do lote na fila até ele ser aplicado).
+ * No fim, o mesmo fluxo é aplicado por uma única thread e os estados das
+ * sessões são comparados.
+ *
+ * Compilação: gcc -O2 -pthread Detective_Quest_Sessoes.c -o Detective_Quest_Sessoes
+ * Uso: ./Detective_Quest_Sessoes [sessoes] [comandos] [qtd_threads]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+
+#define MAX_THREADS 64
+#define TAM_LOTE 256          // Comandos por lote enviado a uma trabalhadora
+#define LOTES_POR_THREAD 16   // Lotes em circulação por trabalhadora (fila limitada)
+#define QTD_FAIXAS 64         // Faixas do histograma de latência (potências de 2 em ns)
+
+// ============================================================================
+// MAPA COMPARTILHADO (SOMENTE LEITURA DEPOIS DE MONTADO)
+// ============================================================================
+
+// Sala do Detective_Quest_Pistas.c com o ID da pista no lugar do bitset
+typedef struct Sala {
+    char nome[50];
+    char pista[100];        // Pista associada ao cômodo (pode ser vazia)
+    struct Sala* esquerda;  // Caminho à esquerda
+    struct Sala* direita;   // Caminho à direita
+    int idPista;            // ID da pista no mapa (-1 = sala sem pista)
+} Sala;
+
+typedef struct {
+    Sala** salas;           // salas[0] é o Hall de Entrada
+    int qtdSalas;
+    const char** textos;    // textos[id], em ordem alfabética
+    int qtdPistas;
+    int palavras;           // uint64_t por bitset de sessão
+} MapaCompartilhado;
+
+// ============================================================================
+// SESSÕES E FILAS DO POOL
+// ============================================================================
+
+typedef struct {
+    const Sala* posicao;
+    uint32_t passos;        // Comandos aplicados desde o início da sessão atual
+    uint32_t qtdPistas;     // Bits ligados no bitset da sessão
+    uint32_t encerradas;    // Vezes que o jogador saiu e recomeçou
+    uint32_t bloqueados;    // Comandos para caminhos inexistentes
+} Sessao;
+
+typedef struct {
+    uint32_t sessao;
+    char acao;              // 'e', 'd' ou 's'
+} Comando;
+
+typedef struct {
+    Comando comandos[TAM_LOTE];
+    int qtd;
+    double enfileirado;     // Instante em que o lote entrou na fila
+} Lote;
+
+// Fila circular limitada de lotes (um produtor, um consumidor)
+typedef struct {
+    Lote* itens[LOTES_POR_THREAD + 1];
+    int inicio;
+    int qtd;
+    pthread_mutex_t trava;
+    pthread_cond_t mudou;
+} FilaLotes;
+
+typedef struct {
+    int id;
+    const MapaCompartilhado* mapa;
+    Sessao* sessoes;        // Vetor de todas as sessões (só usa a sua faixa)
+    uint64_t* bits;         // Bitsets de todas as sessões, um após o outro
+    FilaLotes cheios;       // Produtor -> trabalhadora (NULL = fim do fluxo)
+    FilaLotes livres;       // Trabalhadora -> produtor
+    long comandos;
+    double tempoServico;    // Soma do tempo gasto aplicando comandos
+    long latencias[QTD_FAIXAS];
+    Lote* lotes;            // Memória dos lotes desta trabalhadora
+} Trabalhadora;
+
+// ============================================================================
+// FUNÇÕES AUXILIARES
+// ============================================================================
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+double agoraSegundos() {
+    struct timespec t;
+    timespec_get(&t, TIME_UTC);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Auxiliar do qsort/bsearch: ordem alfabética
+int compararTextos(const void* a, const void* b) {
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+void* alocar(size_t tamanho) {
+    void* p = malloc(tamanho);
+    if (p == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    return p;
+}
+
+// ============================================================================
+// MONTAGEM DO MAPA
+// ============================================================================
+
+/*
+ * Função: gerarMapa
+ * Cria 'qtdSalas' salas ligadas em uma árvore binária aleatória, com pistas
+ * sorteadas de 'qtdPistas' textos, e numera as pistas distintas. Depois
+ * disso o mapa não muda mais e pode ser lido por qualquer thread.
+ */
+void gerarMapa(MapaCompartilhado* mapa, int qtdSalas, int qtdPistas) {
+    const char* objetos[] = {"Pegadas de lama", "Relógio parado", "Livro de venenos", "Taça quebrada",
+                             "Chave enferrujada", "Carta rasgada", "Luva manchada", "Vela apagada"};
+    const char* locais[] = {"perto da janela", "sob o tapete", "atrás da estante", "no corredor"};
+    mapa->salas = (Sala**)alocar(qtdSalas * sizeof(Sala*));
+    mapa->qtdSalas = qtdSalas;
+    for (int i = 0; i < qtdSalas; i++) {
+        Sala* sala = (Sala*)alocar(sizeof(Sala));
+        if (i == 0) strcpy(sala->nome, "Hall de Entrada");
+        else sprintf(sala->nome, "Sala %d", i);
+        int p = aleatorio() % qtdPistas;
+        if (i % 5 == 4) sala->pista[0] = '\0'; // Algumas salas sem pista
+        else sprintf(sala->pista, "%s %s (registro %d)", objetos[p % 8], locais[(p / 8) % 4], p);
+        sala->esquerda = NULL;
+        sala->direita = NULL;
+        if (i > 0) {
+            // Pendura a sala em uma posição livre de uma sala anterior
+            while (true) {
+                Sala* pai = mapa->salas[aleatorio() % i];
+                if (pai->esquerda == NULL) { pai->esquerda = sala; break; }
+                if (pai->direita == NULL) { pai->direita = sala; break; }
+            }
+        }
+        mapa->salas[i] = sala;
+    }
+
+    // IDs das pistas: textos distintos em ordem alfabética
+    const char** textos = (const char**)alocar(qtdSalas * sizeof(const char*));
+    int qtd = 0;
+    for (int i = 0; i < qtdSalas; i++) {
+        if (mapa->salas[i]->pista[0] != '\0') textos[qtd++] = mapa->salas[i]->pista;
+    }
+    qsort(textos, qtd, sizeof(const char*), compararTextos);
+    int distintas = 0;
+    for (int i = 0; i < qtd; i++) {
+        if (distintas == 0 || strcmp(textos[distintas - 1], textos[i]) != 0) textos[distintas++] = textos[i];
+    }
+    mapa->textos = textos;
+    mapa->qtdPistas = distintas;
+    mapa->palavras = distintas > 0 ? (distintas + 63) / 64 : 1;
+
+    for (int i = 0; i < qtdSalas; i++) {
+        Sala* sala = mapa->salas[i];
+        sala->idPista = -1;
+        if (sala->pista[0] != '\0') {
+            const char* chave = sala->pista;
+            const char** achado = (const char**)bsearch(&chave, textos, distintas, sizeof(const char*),
+                                                        compararTextos);
+            sala->idPista = (int)(achado - textos);
+        }
+    }
+}
+
+void liberarMapa(MapaCompartilhado* mapa) {
+    for (int i = 0; i < mapa->qtdSalas; i++) free(mapa->salas[i]);
+    free(mapa->salas);
+    free(mapa->textos);
+}
+
+// ============================================================================
+// SESSÕES
+// ============================================================================
+
+// Auxiliar: coleta a pista da sala atual no bitset da sessão
+void coletarPistaSala(Sessao* sessao, uint64_t* bits) {
+    int id = sessao->posicao->idPista;
+    if (id < 0) return;
+    uint64_t bit = 1ULL << (id % 64);
+    if (!(bits[id / 64] & bit)) {
+        bits[id / 64] |= bit;
+        sessao->qtdPistas++;
+    }
+}
+
+/*
+ * Função: iniciarSessao
+ * Coloca o jogador no Hall de Entrada com o caderno vazio e coleta a pista
+ * da entrada, como o explorarSalasComPistas faz ao começar.
+ */
+void iniciarSessao(const MapaCompartilhado* mapa, Sessao* sessao, uint64_t* bits) {
+    sessao->posicao = mapa->salas[0];
+    sessao->passos = 0;
+    sessao->qtdPistas = 0;
+    memset(bits, 0, mapa->palavras * sizeof(uint64_t));
+    coletarPistaSala(sessao, bits);
+}
+
+/*
+ * Função: aplicarComando
+ * Um passo de uma sessão. Só lê o mapa e só escreve na própria sessão.
+ */
+void aplicarComando(const MapaCompartilhado* mapa, Sessao* sessao, uint64_t* bits, char acao) {
+    const Sala* proxima = NULL;
+    if (acao == 'e') proxima = sessao->posicao->esquerda;
+    else if (acao == 'd') proxima = sessao->posicao->direita;
+    else if (acao == 's') {
+        sessao->encerradas++;
+        iniciarSessao(mapa, sessao, bits);
+        return;
+    }
+
+    sessao->passos++;
+    if (proxima == NULL) {
+        sessao->bloqueados++; // "Caminho bloqueado ou inexistente"
+        return;
+    }
+    sessao->posicao = proxima;
+    coletarPistaSala(sessao, bits);
+}
+
+void iniciarTodasSessoes(const MapaCompartilhado* mapa, Sessao* sessoes, uint64_t* bits, int qtdSessoes) {
+    for (int s = 0; s < qtdSessoes; s++) {
+        sessoes[s].encerradas = 0;
+        sessoes[s].bloqueados = 0;
+        iniciarSessao(mapa, &sessoes[s], bits + (size_t)s * mapa->palavras);
+    }
+}
+
+/*
+ * Função: gerarFluxo
+ * Fluxo sintético: a cada comando um jogador aleatório anda para a esquerda
+ * ou para a direita; num beco sem saída, ou de vez em quando, ele sai.
+ * Simula o estado de cada sessão para que os comandos façam sentido.
+ */
+Comando* gerarFluxo(const MapaCompartilhado* mapa, int qtdSessoes, long qtdComandos) {
+    Comando* fluxo = (Comando*)alocar(qtdComandos * sizeof(Comando));
+    const Sala** posicoes = (const Sala**)alocar(qtdSessoes * sizeof(const Sala*));
+    for (int s = 0; s < qtdSessoes; s++) posicoes[s] = mapa->salas[0];
+    for (long c = 0; c < qtdComandos; c++) {
+        int s = aleatorio() % qtdSessoes;
+        const Sala* atual = posicoes[s];
+        char acao;
+        if ((atual->esquerda == NULL && atual->direita == NULL) || aleatorio() % 64 == 0) acao = 's';
+        else if (atual->esquerda && atual->direita) acao = (rand() % 2) ? 'e' : 'd';
+        else if (aleatorio() % 16 == 0) acao = atual->esquerda ? 'd' : 'e'; // Tenta um caminho bloqueado
+        else acao = atual->esquerda ? 'e' : 'd';
+
+        if (acao == 's') posicoes[s] = mapa->salas[0];
+        else if (acao == 'e' && atual->esquerda) posicoes[s] = atual->esquerda;
+        else if (acao == 'd' && atual->direita) posicoes[s] = atual->direita;
+        fluxo[c].sessao = (uint32_t)s;
+        fluxo[c].acao = acao;
+    }
+    free(posicoes);
+    return fluxo;
+}
+
+// ============================================================================
+// POOL DE THREADS
+// ============================================================================
+
+void iniciarFila(FilaLotes* fila) {
+    fila->inicio = 0;
+    fila->qtd = 0;
+    pthread_mutex_init(&fila->trava, NULL);
+    pthread_cond_init(&fila->mudou, NULL);
+}
+
+void destruirFila(FilaLotes* fila) {
+    pthread_mutex_destroy(&fila->trava);
+    pthread_cond_destroy(&fila->mudou);
+}
+
+// A fila comporta todos os lotes da trabalhadora mais o NULL de fim, então
+// colocar nunca espera: quem limita o fluxo é a fila de livres.
+void colocarLote(FilaLotes* fila, Lote* lote) {
+    pthread_mutex_lock(&fila->trava);
+    fila->itens[(fila->inicio + fila->qtd) % (LOTES_POR_THREAD + 1)] = lote;
+    fila->qtd++;
+    pthread_cond_signal(&fila->mudou);
+    pthread_mutex_unlock(&fila->trava);
+}
+
+Lote* retirarLote(FilaLotes* fila) {
+    pthread_mutex_lock(&fila->trava);
+    while (fila->qtd == 0) pthread_cond_wait(&fila->mudou, &fila->trava);
+    Lote* lote = fila->itens[fila->inicio];
+    fila->inicio = (fila->inicio + 1) % (LOTES_POR_THREAD + 1);
+    fila->qtd--;
+    pthread_mutex_unlock(&fila->trava);
+    return lote;
+}
+
+// Auxiliar: faixa do histograma (floor(log2(ns)))
+int faixaLatencia(double segundos) {
+    uint64_t ns = (uint64_t)(segundos * 1e9);
+    int faixa = 0;
+    while (ns > 1 && faixa < QTD_FAIXAS - 1) { ns >>= 1; faixa++; }
+    return faixa;
+}
+
+/*
+ * Função: executarTrabalhadora
+ * Aplica os lotes da sua fila até receber NULL. Todos os comandos de um
+ * lote recebem a mesma latência: do enfileiramento até o fim do lote.
+ */
+void* executarTrabalhadora(void* arg) {
+    Trabalhadora* t = (Trabalhadora*)arg;
+    const MapaCompartilhado* mapa = t->mapa;
+    Lote* lote;
+    while ((lote = retirarLote(&t->cheios)) != NULL) {
+        double inicio = agoraSegundos();
+        for (int i = 0; i < lote->qtd; i++) {
+            uint32_t s = lote->comandos[i].sessao;
+            aplicarComando(mapa, &t->sessoes[s], t->bits + (size_t)s * mapa->palavras, lote->comandos[i].acao);
+        }
+        double fim = agoraSegundos();
+        t->tempoServico += fim - inicio;
+        t->latencias[faixaLatencia(fim - lote->enfileirado)] += lote->qtd;
+        t->comandos += lote->qtd;
+        colocarLote(&t->livres, lote);
+    }
+    return NULL;
+}
+
+/*
+ * Função: executarPool
+ * O produtor lê o fluxo em ordem e separa os comandos pela trabalhadora dona
+ * da sessão. Retorna o tempo total (do primeiro comando ao último aplicado).
+ */
+double executarPool(Trabalhadora* trabalhadoras, int qtdThreads, int qtdSessoes, const Comando* fluxo,
+                    long qtdComandos) {
+    // Faixas contínuas: com sessao % qtdThreads, as sessões de 24 bytes de uma
+    // mesma linha de cache seriam escritas por threads diferentes (falso compartilhamento)
+    uint32_t sessoesPorThread = (uint32_t)((qtdSessoes + qtdThreads - 1) / qtdThreads);
+    pthread_t threads[MAX_THREADS];
+    Lote* abertos[MAX_THREADS];
+    for (int t = 0; t < qtdThreads; t++) {
+        Trabalhadora* tr = &trabalhadoras[t];
+        iniciarFila(&tr->cheios);
+        iniciarFila(&tr->livres);
+        tr->lotes = (Lote*)alocar(LOTES_POR_THREAD * sizeof(Lote));
+        for (int i = 0; i < LOTES_POR_THREAD; i++) colocarLote(&tr->livres, &tr->lotes[i]);
+        abertos[t] = NULL;
+    }
+
+    double inicio = agoraSegundos();
+    for (int t = 0; t < qtdThreads; t++) pthread_create(&threads[t], NULL, executarTrabalhadora, &trabalhadoras[t]);
+
+    for (long c = 0; c < qtdComandos; c++) {
+        int t = (int)(fluxo[c].sessao / sessoesPorThread);
+        if (abertos[t] == NULL) {
+            abertos[t] = retirarLote(&trabalhadoras[t].livres); // Espera se a trabalhadora está atrasada
+            abertos[t]->qtd = 0;
+        }
+        Lote* lote = abertos[t];
+        lote->comandos[lote->qtd++] = fluxo[c];
+        if (lote->qtd == TAM_LOTE) {
+            lote->enfileirado = agoraSegundos();
+            colocarLote(&trabalhadoras[t].cheios, lote);
+            abertos[t] = NULL;
+        }
+    }
+    for (int t = 0; t < qtdThreads; t++) {
+        if (abertos[t] != NULL) {
+            abertos[t]->enfileirado = agoraSegundos();
+            colocarLote(&trabalhadoras[t].cheios, abertos[t]);
+        }
+        colocarLote(&trabalhadoras[t].cheios, NULL); // Fim do fluxo
+    }
+    for (int t = 0; t < qtdThreads; t++) pthread_join(threads[t], NULL);
+    double tempo = agoraSegundos() - inicio;
+
+    for (int t = 0; t < qtdThreads; t++) {
+        destruirFila(&trabalhadoras[t].cheios);
+        destruirFila(&trabalhadoras[t].livres);
+        free(trabalhadoras[t].lotes);
+    }
+    return tempo;
+}
+
+// Auxiliar: percentil do histograma (limite superior da faixa, em microssegundos)
+double percentilLatencia(const long* latencias, long total, double fracao) {
+    long acumulado = 0;
+    for (int f = 0; f < QTD_FAIXAS; f++) {
+        acumulado += latencias[f];
+        if (acumulado >= fracao * total) return (double)(2ULL << f) / 1000.0;
+    }
+    return 0;
+}
+
+// ============================================================================
+// FUNÇÃO PRINCIPAL
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    int qtdSessoes = 100000;
+    long qtdComandos = 20000000;
+    int qtdThreads = 4;
+    if (argc > 1 && atoi(argv[1]) > 0) qtdSessoes = atoi(argv[1]);
+    if (argc > 2 && atol(argv[2]) > 0) qtdComandos = atol(argv[2]);
+    if (argc > 3 && atoi(argv[3]) > 0) qtdThreads = atoi(argv[3]);
+    if (qtdThreads > MAX_THREADS) qtdThreads = MAX_THREADS;
+
+    printf("========================================================\n");
+    printf("   DETECTIVE QUEST: MOTOR DE SESSÕES (MAPA COMPARTILHADO)\n");
+    printf("========================================================\n");
+
+    srand(42);
+    MapaCompartilhado mapa;
+    gerarMapa(&mapa, 200000, 1000);
+    printf("Mapa: %d salas, %d pistas distintas (compartilhado por todos)\n", mapa.qtdSalas, mapa.qtdPistas);
+
+    Sessao* sessoes = (Sessao*)alocar(qtdSessoes * sizeof(Sessao));
+    uint64_t* bits = (uint64_t*)alocar((size_t)qtdSessoes * mapa.palavras * sizeof(uint64_t));
+    printf("Sessoes: %d | %zu bytes por sessao (%.1f MB no total)\n", qtdSessoes,
+           sizeof(Sessao) + mapa.palavras * sizeof(uint64_t),
+           qtdSessoes * (sizeof(Sessao) + mapa.palavras * sizeof(uint64_t)) / (1024.0 * 1024.0));
+
+    Comando* fluxo = gerarFluxo(&mapa, qtdSessoes, qtdComandos);
+    printf("Fluxo: %ld comandos | %d threads | lotes de %d\n\n", qtdComandos, qtdThreads, TAM_LOTE);
+
+    // 1. Pool de threads
+    iniciarTodasSessoes(&mapa, sessoes, bits, qtdSessoes);
+    Trabalhadora* trabalhadoras = (Trabalhadora*)calloc(qtdThreads, sizeof(Trabalhadora));
+    if (trabalhadoras == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (int t = 0; t < qtdThreads; t++) {
+        trabalhadoras[t].id = t;
+        trabalhadoras[t].mapa = &mapa;
+        trabalhadoras[t].sessoes = sessoes;
+        trabalhadoras[t].bits = bits;
+    }
+    double tempoPool = executarPool(trabalhadoras, qtdThreads, qtdSessoes, fluxo, qtdComandos);
+
+    long latencias[QTD_FAIXAS] = {0};
+    double servico = 0;
+    printf("%-14s %12s %14s\n", "Thread", "Comandos", "ns por passo");
+    for (int t = 0; t < qtdThreads; t++) {
+        Trabalhadora* tr = &trabalhadoras[t];
+        printf("%-14d %12ld %14.1f\n", t, tr->comandos, tr->comandos ? tr->tempoServico * 1e9 / tr->comandos : 0.0);
+        for (int f = 0; f < QTD_FAIXAS; f++) latencias[f] += tr->latencias[f];
+        servico += tr->tempoServico;
+    }
+    printf("\n%-32s %12.2f\n", "Tempo total (s)", tempoPool);
+    printf("%-32s %12.2f\n", "Vazao (milhoes de passos/s)", qtdComandos / tempoPool / 1e6);
+    printf("%-32s %12.1f\n", "Servico medio (ns por passo)", servico * 1e9 / qtdComandos);
+    printf("%-32s %12.1f\n", "Latencia p50 (us, ate)", percentilLatencia(latencias, qtdComandos, 0.50));
+    printf("%-32s %12.1f\n", "Latencia p99 (us, ate)", percentilLatencia(latencias, qtdComandos, 0.99));
+    printf("%-32s %12.1f\n", "Latencia maxima (us, ate)", percentilLatencia(latencias, qtdComandos, 1.0));
+
+    // 2. Referência: o mesmo fluxo aplicado em ordem por uma só thread
+    Sessao* sessoesRef = (Sessao*)alocar(qtdSessoes * sizeof(Sessao));
+    uint64_t* bitsRef = (uint64_t*)alocar((size_t)qtdSessoes * mapa.palavras * sizeof(uint64_t));
+    iniciarTodasSessoes(&mapa, sessoesRef, bitsRef, qtdSessoes);
+    double inicio = agoraSegundos();
+    for (long c = 0; c < qtdComandos; c++) {
+        uint32_t s = fluxo[c].sessao;
+        aplicarComando(&mapa, &sessoesRef[s], bitsRef + (size_t)s * mapa.palavras, fluxo[c].acao);
+    }
+    double tempoRef = agoraSegundos() - inicio;
+    printf("%-32s %12.2f\n", "Uma thread, sem filas (s)", tempoRef);
+
+    bool confere = memcmp(bits, bitsRef, (size_t)qtdSessoes * mapa.palavras * sizeof(uint64_t)) == 0;
+    long pistasColetadas = 0, encerradas = 0, bloqueados = 0;
+    for (int s = 0; confere && s < qtdSessoes; s++) {
+        confere = sessoes[s].posicao == sessoesRef[s].posicao && sessoes[s].passos == sessoesRef[s].passos &&
+                  sessoes[s].qtdPistas == sessoesRef[s].qtdPistas &&
+                  sessoes[s].encerradas == sessoesRef[s].encerradas &&
+                  sessoes[s].bloqueados == sessoesRef[s].bloqueados;
+        pistasColetadas += sessoes[s].qtdPistas;
+        encerradas += sessoes[s].encerradas;
+        bloqueados += sessoes[s].bloqueados;
+    }
+    printf("\nSessoes encerradas: %ld | caminhos bloqueados: %ld | pistas nos cadernos: %ld\n",
+           encerradas, bloqueados, pistasColetadas);
+    printf("Estados das sessoes %s\n", confere ? "CONFEREM com a execucao sequencial"
+                                               : "DIVERGEM da execucao sequencial (ERRO!)");
+
+    free(trabalhadoras);
+    free(sessoes);
+    free(bits);
+    free(sessoesRef);
+    free(bitsRef);
+    free(fluxo);
+    liberarMapa(&mapa);
+    printf("\nFim do programa.\n");
+    return confere ? 0 : 1;
+}
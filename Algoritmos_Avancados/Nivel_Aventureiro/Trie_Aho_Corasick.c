@@ -0,0 +1,476 @@
+/*
+ * Objetivo: Procurar milhares de palavras-chave de uma vez em textos grandes
+ *           (logs) com o algoritmo de Aho-Corasick sobre a Trie do BST_TRIE.c.
+ *
+ * Problema: chamar buscarTrie para cada substring do texto é quadrático.
+ *
+ * Ideia: depois de inserir os padrões na Trie, uma busca em largura (BFS)
+ * adiciona a cada nó:
+ * - Ligação de falha: o nó do maior sufixo próprio do caminho atual que
+ *   também é prefixo de algum padrão. Quando o próximo byte não tem filho,
+ *   seguimos a falha em vez de voltar no texto.
+ * - Ligação de saída: o nó de fim de padrão mais próximo na cadeia de
+ *   falhas, para listar padrões que terminam dentro de outros ("he" em "she").
+ *
+ * O texto é lido uma única vez, em blocos grandes; o estado do autômato passa
+ * de um bloco para o outro, então ocorrências na fronteira não se perdem.
+ * Letras ASCII são comparadas sem diferenciar maiúsculas (charParaIndice).
+ *
+ * Uso: ./Trie_Aho_Corasick [palavras_chave.txt arquivo_de_texto]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+
+#define TAM_BLOCO (1 << 20) // Bytes lidos por vez do texto
+#define TAM_PALAVRA 100     // Tamanho máximo de palavra-chave
+
+// ============================================================================
+// ESTRUTURA: TRIE (NoTrie do BST_TRIE.c) COM LIGAÇÕES DE AHO-CORASICK
+// ============================================================================
+
+typedef struct NoTrie {
+    uint64_t mapa[4];         // 256 bits: bit b ligado = existe filho para o byte b
+    struct NoTrie** filhos;   // Somente os filhos que existem, em ordem crescente de byte
+    unsigned short qtdFilhos; // Tamanho do vetor filhos
+    bool fimDaPalavra;        // Marca se este nó encerra um padrão
+    int idPadrao;             // Índice do padrão que termina aqui (-1 = nenhum)
+    int profundidade;         // Tamanho do caminho desde a raiz
+    struct NoTrie* falha;     // Maior sufixo próprio que também é prefixo de um padrão
+    struct NoTrie* saida;     // Próximo fim de padrão na cadeia de falhas (ou NULL)
+} NoTrie;
+
+// Auxiliar: quantidade de bits ligados em uma palavra de 64 bits
+int contarBits(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int total = 0;
+    while (x) { x &= x - 1; total++; }
+    return total;
+#endif
+}
+
+// Auxiliar: índice do bit ligado mais baixo (x != 0)
+int indiceMenorBit(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int i = 0;
+    while (!(x & 1)) { x >>= 1; i++; }
+    return i;
+#endif
+}
+
+// Auxiliar: posição do filho do byte b no vetor denso
+int posicaoFilho(NoTrie* no, int b) {
+    int palavra = b >> 6;
+    uint64_t antes = no->mapa[palavra] & ((1ULL << (b & 63)) - 1);
+    int pos = contarBits(antes);
+    for (int i = 0; i < palavra; i++) pos += contarBits(no->mapa[i]);
+    return pos;
+}
+
+// Auxiliar: retorna o filho do byte b ou NULL
+NoTrie* obterFilho(NoTrie* no, int b) {
+    if (!(no->mapa[b >> 6] & (1ULL << (b & 63)))) return NULL;
+    return no->filhos[posicaoFilho(no, b)];
+}
+
+NoTrie* criarNoTrie() {
+    NoTrie* novo = (NoTrie*)calloc(1, sizeof(NoTrie));
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    novo->idPadrao = -1;
+    return novo;
+}
+
+// Auxiliar: cria o filho do byte b mantendo o vetor denso ordenado
+NoTrie* adicionarFilho(NoTrie* no, int b) {
+    NoTrie* filho = criarNoTrie();
+    NoTrie** novos = (NoTrie**)realloc(no->filhos, (no->qtdFilhos + 1) * sizeof(NoTrie*));
+    if (novos == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    int pos = posicaoFilho(no, b);
+    memmove(&novos[pos + 1], &novos[pos], (no->qtdFilhos - pos) * sizeof(NoTrie*));
+    novos[pos] = filho;
+    no->filhos = novos;
+    no->qtdFilhos++;
+    no->mapa[b >> 6] |= 1ULL << (b & 63);
+    filho->profundidade = no->profundidade + 1;
+    return filho;
+}
+
+// Auxiliar: Converte char para índice (0 a 255), igual ao BST_TRIE.c
+int charParaIndice(char c) {
+    unsigned char b = (unsigned char)c;
+    if (b < 128) return tolower(b);
+    return b;
+}
+
+// Insere um padrão e guarda o seu índice no nó final
+void inserirPadrao(NoTrie* raiz, char* palavra, int id) {
+    NoTrie* atual = raiz;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+        NoTrie* proximo = obterFilho(atual, indice);
+        if (proximo == NULL) proximo = adicionarFilho(atual, indice);
+        atual = proximo;
+    }
+    if (atual == raiz) return; // Padrão vazio não é aceito
+    atual->fimDaPalavra = true;
+    atual->idPadrao = id;
+}
+
+// Busca uma palavra exata (igual ao BST_TRIE.c)
+bool buscarTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        atual = obterFilho(atual, charParaIndice(palavra[i]));
+        if (atual == NULL) return false;
+    }
+    return atual->fimDaPalavra;
+}
+
+void liberarTrie(NoTrie* raiz) {
+    if (raiz == NULL) return;
+    for (int i = 0; i < raiz->qtdFilhos; i++) liberarTrie(raiz->filhos[i]);
+    free(raiz->filhos);
+    free(raiz);
+}
+
+// ============================================================================
+// CONSTRUÇÃO DAS LIGAÇÕES DE FALHA E SAÍDA
+// ============================================================================
+
+// Preenche falha e saida de todos os nós. Deve ser chamada depois de todas as
+// inserções (uma nova inserção exige chamar de novo).
+// Em largura: a falha de um nó sempre aponta para um nó mais raso, já pronto.
+void construirAhoCorasick(NoTrie* raiz) {
+    int capacidade = 1024, inicio = 0, fim = 0;
+    NoTrie** fila = (NoTrie**)malloc(capacidade * sizeof(NoTrie*));
+    if (fila == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    raiz->falha = raiz;
+    raiz->saida = NULL;
+    fila[fim++] = raiz;
+
+    while (inicio < fim) {
+        NoTrie* no = fila[inicio++];
+        int k = 0;
+        for (int p = 0; p < 4; p++) {
+            uint64_t bits = no->mapa[p];
+            while (bits) {
+                int b = p * 64 + indiceMenorBit(bits);
+                bits &= bits - 1;
+                NoTrie* filho = no->filhos[k++];
+
+                // Falha do filho: desce pelo byte b a partir da falha do pai
+                if (no == raiz) {
+                    filho->falha = raiz;
+                } else {
+                    NoTrie* f = no->falha;
+                    while (f != raiz && obterFilho(f, b) == NULL) f = f->falha;
+                    NoTrie* destino = obterFilho(f, b);
+                    filho->falha = destino ? destino : raiz;
+                }
+                filho->saida = filho->falha->fimDaPalavra ? filho->falha : filho->falha->saida;
+
+                if (fim == capacidade) {
+                    capacidade *= 2;
+                    NoTrie** maior = (NoTrie**)realloc(fila, capacidade * sizeof(NoTrie*));
+                    if (maior == NULL) {
+                        printf("Erro crítico: Falha na alocação de memória.\n");
+                        exit(1);
+                    }
+                    fila = maior;
+                }
+                fila[fim++] = filho;
+            }
+        }
+    }
+    free(fila);
+}
+
+// ============================================================================
+// VARREDURA DO TEXTO
+// ============================================================================
+
+// Função chamada para cada ocorrência: índice do padrão e posição (em bytes)
+// do primeiro caractere dela no texto
+typedef void (*VisitarOcorrencia)(int idPadrao, long long inicio, void* contexto);
+
+// Estado que passa de um bloco para o próximo
+typedef struct {
+    NoTrie* raiz;
+    NoTrie* estado;
+    long long posicao; // Bytes já consumidos
+    VisitarOcorrencia visitar;
+    void* contexto;
+} Varredor;
+
+void iniciarVarredor(Varredor* v, NoTrie* raiz, VisitarOcorrencia visitar, void* contexto) {
+    v->raiz = raiz;
+    v->estado = raiz;
+    v->posicao = 0;
+    v->visitar = visitar;
+    v->contexto = contexto;
+}
+
+// Consome um bloco do texto. Cada byte custa O(1) amortizado.
+void varrerBloco(Varredor* v, const char* texto, size_t tam) {
+    NoTrie* raiz = v->raiz;
+    NoTrie* estado = v->estado;
+    for (size_t i = 0; i < tam; i++) {
+        int b = charParaIndice(texto[i]);
+        NoTrie* proximo;
+        while ((proximo = obterFilho(estado, b)) == NULL && estado != raiz) estado = estado->falha;
+        estado = proximo ? proximo : raiz;
+
+        long long fimOcorrencia = v->posicao + (long long)i + 1;
+        NoTrie* achado = estado->fimDaPalavra ? estado : estado->saida;
+        for (; achado != NULL; achado = achado->saida) {
+            v->visitar(achado->idPadrao, fimOcorrencia - achado->profundidade, v->contexto);
+        }
+    }
+    v->estado = estado;
+    v->posicao += (long long)tam;
+}
+
+// Lê o arquivo inteiro em blocos de TAM_BLOCO. Retorna os bytes lidos (-1 = erro).
+long long varrerArquivo(NoTrie* raiz, FILE* arquivo, VisitarOcorrencia visitar, void* contexto) {
+    char* bloco = (char*)malloc(TAM_BLOCO);
+    if (bloco == NULL) return -1;
+    Varredor v;
+    iniciarVarredor(&v, raiz, visitar, contexto);
+    size_t lidos;
+    while ((lidos = fread(bloco, 1, TAM_BLOCO, arquivo)) > 0) varrerBloco(&v, bloco, lidos);
+    free(bloco);
+    return ferror(arquivo) ? -1 : v.posicao;
+}
+
+// ============================================================================
+// MAIN: TESTES E COMPARAÇÃO
+// ============================================================================
+
+typedef struct {
+    char** padroes;
+    long* ocorrencias; // Por padrão
+    long total;
+} Contagem;
+
+// Visitante: imprime cada ocorrência
+void imprimirOcorrencia(int idPadrao, long long inicio, void* contexto) {
+    char** padroes = (char**)contexto;
+    printf("  '%s' na posicao %lld\n", padroes[idPadrao], inicio);
+}
+
+// Visitante: só conta
+void contarOcorrencia(int idPadrao, long long inicio, void* contexto) {
+    (void)inicio;
+    Contagem* c = (Contagem*)contexto;
+    c->ocorrencias[idPadrao]++;
+    c->total++;
+}
+
+// Referência ingênua: buscarTrie em cada substring (até o maior padrão)
+long contarIngenuo(NoTrie* raiz, const char* texto, long tam, int maiorPadrao) {
+    char sub[TAM_PALAVRA + 1];
+    long total = 0;
+    for (long i = 0; i < tam; i++) {
+        for (int t = 1; t <= maiorPadrao && i + t <= tam; t++) {
+            memcpy(sub, texto + i, t);
+            sub[t] = '\0';
+            if (memchr(sub, '\0', t) == NULL && buscarTrie(raiz, sub)) total++;
+        }
+    }
+    return total;
+}
+
+// Palavras de 2 a 4 sílabas
+void gerarPalavra(char* destino) {
+    const char* silabas[] = {
+        "ca", "sa", "ro", "mi", "nha", "de", "to", "pe", "li", "ra",
+        "bo", "ma", "te", "co", "la", "ve", "ne", "di", "so", "pa",
+        "men", "tra", "gu", "fi", "cao", "ar", "es", "in", "con", "por"
+    };
+    destino[0] = '\0';
+    int partes = 2 + rand() % 3;
+    for (int p = 0; p < partes; p++) strcat(destino, silabas[rand() % 30]);
+}
+
+// Lê uma palavra-chave por linha. Retorna a quantidade lida.
+int carregarPadroes(const char* caminho, char*** padroes) {
+    FILE* arquivo = fopen(caminho, "r");
+    if (arquivo == NULL) return 0;
+    int capacidade = 1024, qtd = 0;
+    char linha[TAM_PALAVRA + 3]; // Palavra + "\r\n" + '\0'
+    *padroes = (char**)malloc(capacidade * sizeof(char*));
+    while (fgets(linha, sizeof(linha), arquivo)) {
+        if (strchr(linha, '\n') == NULL && !feof(arquivo)) {
+            int c;
+            while ((c = fgetc(arquivo)) != '\n' && c != EOF); // Descarta o resto da linha longa
+            continue;
+        }
+        linha[strcspn(linha, "\r\n")] = '\0';
+        if (linha[0] == '\0' || strlen(linha) > TAM_PALAVRA) continue;
+        if (qtd == capacidade) {
+            capacidade *= 2;
+            *padroes = (char**)realloc(*padroes, capacidade * sizeof(char*));
+        }
+        (*padroes)[qtd] = (char*)malloc(strlen(linha) + 1);
+        strcpy((*padroes)[qtd], linha);
+        qtd++;
+    }
+    fclose(arquivo);
+    return qtd;
+}
+
+int main(int argc, char* argv[]) {
+    printf("========================================================\n");
+    printf("      AHO-CORASICK: VARIAS PALAVRAS-CHAVE DE UMA VEZ\n");
+    printf("========================================================\n");
+
+    // ------------------------------------------------------------
+    // TESTE 1: Exemplo clássico
+    // ------------------------------------------------------------
+    char* exemplo[] = {"he", "she", "his", "hers"};
+    NoTrie* raizExemplo = criarNoTrie();
+    for (int i = 0; i < 4; i++) inserirPadrao(raizExemplo, exemplo[i], i);
+    construirAhoCorasick(raizExemplo);
+
+    char textoExemplo[] = "ushers e his SHE";
+    printf("Padroes: he, she, his, hers | Texto: \"%s\"\n", textoExemplo);
+    Varredor v;
+    iniciarVarredor(&v, raizExemplo, imprimirOcorrencia, exemplo);
+    // Em dois pedaços para mostrar que o estado atravessa a fronteira ("us" + "hers ...")
+    varrerBloco(&v, textoExemplo, 2);
+    varrerBloco(&v, textoExemplo + 2, strlen(textoExemplo) - 2);
+    liberarTrie(raizExemplo);
+
+    // ------------------------------------------------------------
+    // TESTE 2: Milhares de palavras-chave em um texto grande
+    // ------------------------------------------------------------
+    char** padroes = NULL;
+    int qtdPadroes = 0;
+    FILE* texto = NULL;
+    if (argc > 2) {
+        qtdPadroes = carregarPadroes(argv[1], &padroes);
+        texto = fopen(argv[2], "rb");
+        if (qtdPadroes == 0 || texto == NULL) {
+            printf("\nNão foi possível ler '%s' ou '%s'. Usando dados sintéticos.\n", argv[1], argv[2]);
+            if (texto) fclose(texto);
+            texto = NULL;
+            for (int i = 0; i < qtdPadroes; i++) free(padroes[i]);
+            free(padroes);
+            qtdPadroes = 0;
+        }
+    }
+
+    srand(42);
+    long tamAmostra = 1 << 20; // Trecho usado na comparação com a versão ingênua
+    char* amostra = (char*)malloc(tamAmostra);
+    if (amostra == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    if (texto == NULL) {
+        qtdPadroes = 5000;
+        padroes = (char**)malloc(qtdPadroes * sizeof(char*));
+        for (int i = 0; i < qtdPadroes; i++) {
+            padroes[i] = (char*)malloc(TAM_PALAVRA);
+            gerarPalavra(padroes[i]);
+        }
+        // Log sintético de ~100 MB em um arquivo temporário (apagado ao fechar)
+        texto = tmpfile();
+        if (texto == NULL) {
+            printf("[ERRO] Não foi possível criar o arquivo temporário.\n");
+            return 1;
+        }
+        char linha[256];
+        for (long long escritos = 0; escritos < 100LL * 1024 * 1024;) {
+            char palavra[TAM_PALAVRA];
+            gerarPalavra(palavra);
+            int tam = sprintf(linha, "[%06d] evento %s status=%d\n", rand() % 1000000, palavra, rand() % 600);
+            fwrite(linha, 1, tam, texto);
+            escritos += tam;
+        }
+        rewind(texto);
+    }
+    printf("\n--- %d palavras-chave ---\n", qtdPadroes);
+
+    NoTrie* raiz = criarNoTrie();
+    int maiorPadrao = 0;
+    for (int i = 0; i < qtdPadroes; i++) {
+        inserirPadrao(raiz, padroes[i], i);
+        int tam = (int)strlen(padroes[i]);
+        if (tam > maiorPadrao) maiorPadrao = tam;
+    }
+    clock_t inicio = clock();
+    construirAhoCorasick(raiz);
+    clock_t fim = clock();
+    printf("Construcao das ligacoes: %f segundos\n", ((double)(fim - inicio)) / CLOCKS_PER_SEC);
+
+    Contagem contagem;
+    contagem.padroes = padroes;
+    contagem.ocorrencias = (long*)calloc(qtdPadroes, sizeof(long));
+    contagem.total = 0;
+
+    inicio = clock();
+    long long bytes = varrerArquivo(raiz, texto, contarOcorrencia, &contagem);
+    fim = clock();
+    double tempoAC = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    if (bytes < 0) {
+        printf("[ERRO] Falha na leitura do texto.\n");
+        return 1;
+    }
+    printf("Texto: %.1f MB | Ocorrencias: %ld | %.3f s (%.1f MB/s)\n",
+           bytes / (1024.0 * 1024.0), contagem.total, tempoAC, bytes / (1024.0 * 1024.0) / tempoAC);
+
+    // Padrões duplicados no arquivo ficam com o índice da última inserção
+    int maisFrequente = 0;
+    for (int i = 1; i < qtdPadroes; i++) {
+        if (contagem.ocorrencias[i] > contagem.ocorrencias[maisFrequente]) maisFrequente = i;
+    }
+    printf("Palavra-chave mais frequente: '%s' (%ld)\n", padroes[maisFrequente], contagem.ocorrencias[maisFrequente]);
+
+    // Comparação com a versão ingênua no primeiro 1 MB
+    rewind(texto);
+    tamAmostra = (long)fread(amostra, 1, tamAmostra, texto);
+    Contagem parcial;
+    parcial.padroes = padroes;
+    parcial.ocorrencias = (long*)calloc(qtdPadroes, sizeof(long));
+    parcial.total = 0;
+    iniciarVarredor(&v, raiz, contarOcorrencia, &parcial);
+    varrerBloco(&v, amostra, tamAmostra);
+
+    inicio = clock();
+    long totalIngenuo = contarIngenuo(raiz, amostra, tamAmostra, maiorPadrao);
+    fim = clock();
+    double tempoIngenuo = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    printf("Ingenuo (buscarTrie em cada substring) no 1o MB: %.3f s (%.2f MB/s)\n",
+           tempoIngenuo, tamAmostra / (1024.0 * 1024.0) / tempoIngenuo);
+    printf("Resultados %s (%ld ocorrencias no 1o MB)\n",
+           parcial.total == totalIngenuo ? "CONFEREM" : "DIVERGEM (ERRO!)", parcial.total);
+
+    fclose(texto);
+    liberarTrie(raiz);
+    for (int i = 0; i < qtdPadroes; i++) free(padroes[i]);
+    free(padroes);
+    free(contagem.ocorrencias);
+    free(parcial.ocorrencias);
+    free(amostra);
+    printf("\nMemoria liberada. Fim do programa.\n");
+    return 0;
+}
@@ -0,0 +1,312 @@
+/*
+ * Objetivo: Autocompletar com as K palavras mais frequentes de um prefixo.
+ *
+ * A Trie do BST_TRIE.c responde apenas "a palavra existe?". Para sugerir
+ * complementos precisamos de:
+ *   1. Frequência: cada nó que encerra palavra guarda quantas vezes ela foi vista.
+ *   2. Cache dos melhores: cada nó guarda as TOP_K palavras mais frequentes da
+ *      sua subárvore. A consulta só desce até o nó do prefixo e copia a lista,
+ *      sem visitar a subárvore (que pode ter milhares de palavras).
+ *
+ * Como as frequências só aumentam, ao registrar uma ocorrência basta atualizar
+ * as listas dos nós no caminho da palavra (O(tamanho * TOP_K)).
+ *
+ * Também há a listagem completa por prefixo, em ordem alfabética e com
+ * interrupção antecipada, igual à de BST_TRIE.c.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+#include <time.h>
+
+#define TAM_ALFABETO 26  // Considerando apenas letras minúsculas a-z
+#define TAM_PALAVRA 100  // Tamanho máximo de palavra considerado
+#define TOP_K 5          // Quantidade de sugestões guardadas em cada nó
+
+// ============================================================================
+// ESTRUTURA: TRIE COM FREQUÊNCIA E CACHE DE MELHORES
+// ============================================================================
+
+typedef struct NoAuto {
+    struct NoAuto* filhos[TAM_ALFABETO];  // Vetor de ponteiros para as próximas letras
+    long frequencia;                      // 0 = não é fim de palavra
+    char* palavra;                        // Palavra completa (apenas em nós finais)
+    struct NoAuto* melhores[TOP_K];       // Nós finais mais frequentes da subárvore
+    int qtdMelhores;
+} NoAuto;
+
+// Cria um novo nó para a Trie
+NoAuto* criarNoAuto() {
+    NoAuto* novo = (NoAuto*)calloc(1, sizeof(NoAuto));
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    return novo;
+}
+
+// Auxiliar: Converte char para índice (0 a 25)
+int charParaIndice(char c) {
+    return tolower((unsigned char)c) - 'a';
+}
+
+// Auxiliar: a vem antes de b no ranking? (maior frequência; empate em ordem alfabética)
+bool vemAntes(NoAuto* a, NoAuto* b) {
+    if (a->frequencia != b->frequencia) return a->frequencia > b->frequencia;
+    return strcmp(a->palavra, b->palavra) < 0;
+}
+
+// Auxiliar: atualiza a lista de melhores de um nó após 'final' ganhar frequência
+void atualizarMelhores(NoAuto* no, NoAuto* final) {
+    int pos = -1;
+    for (int i = 0; i < no->qtdMelhores; i++) {
+        if (no->melhores[i] == final) { pos = i; break; }
+    }
+
+    if (pos < 0) {
+        // Ainda não está na lista: entra no fim se houver espaço ou se superar o último
+        if (no->qtdMelhores < TOP_K) {
+            pos = no->qtdMelhores++;
+        } else if (vemAntes(final, no->melhores[TOP_K - 1])) {
+            pos = TOP_K - 1;
+        } else {
+            return;
+        }
+        no->melhores[pos] = final;
+    }
+
+    // Sobe a palavra enquanto ela superar a anterior (insertion sort de um passo)
+    while (pos > 0 && vemAntes(no->melhores[pos], no->melhores[pos - 1])) {
+        NoAuto* temp = no->melhores[pos];
+        no->melhores[pos] = no->melhores[pos - 1];
+        no->melhores[pos - 1] = temp;
+        pos--;
+    }
+}
+
+// Registra 'ocorrencias' novas da palavra (insere se não existir)
+void registrarPalavra(NoAuto* raiz, char* palavra, long ocorrencias) {
+    NoAuto* caminho[TAM_PALAVRA];
+    char chave[TAM_PALAVRA];
+    int tam = 0;
+    NoAuto* atual = raiz;
+
+    caminho[0] = raiz;
+    for (int i = 0; palavra[i] != '\0' && tam < TAM_PALAVRA - 1; i++) {
+        int indice = charParaIndice(palavra[i]);
+        if (indice < 0 || indice >= TAM_ALFABETO) continue;
+
+        if (atual->filhos[indice] == NULL) {
+            atual->filhos[indice] = criarNoAuto();
+        }
+        atual = atual->filhos[indice];
+        chave[tam++] = 'a' + indice;
+        caminho[tam] = atual;
+    }
+    chave[tam] = '\0';
+    if (tam == 0 || ocorrencias <= 0) return;
+
+    if (atual->palavra == NULL) {
+        atual->palavra = (char*)malloc(tam + 1);
+        strcpy(atual->palavra, chave);
+    }
+    atual->frequencia += ocorrencias;
+
+    // Todos os nós do caminho (inclusive a raiz) têm esta palavra na subárvore
+    for (int i = 0; i <= tam; i++) {
+        atualizarMelhores(caminho[i], atual);
+    }
+}
+
+// Auxiliar: desce até o nó do prefixo (NULL se não houver palavras com ele)
+NoAuto* buscarNoPrefixo(NoAuto* raiz, char* prefixo) {
+    NoAuto* atual = raiz;
+    for (int i = 0; prefixo[i] != '\0'; i++) {
+        int indice = charParaIndice(prefixo[i]);
+        if (indice < 0 || indice >= TAM_ALFABETO) return NULL;
+        atual = atual->filhos[indice];
+        if (atual == NULL) return NULL;
+    }
+    return atual;
+}
+
+// Copia até k sugestões mais frequentes para o prefixo. Retorna quantas foram copiadas.
+int autocompletar(NoAuto* raiz, char* prefixo, NoAuto* sugestoes[], int k) {
+    NoAuto* no = buscarNoPrefixo(raiz, prefixo);
+    if (no == NULL) return 0;
+    int qtd = (k < no->qtdMelhores) ? k : no->qtdMelhores;
+    for (int i = 0; i < qtd; i++) sugestoes[i] = no->melhores[i];
+    return qtd;
+}
+
+// --- Listagem completa por prefixo (ordem alfabética, com interrupção) ---
+
+// Tipo da função chamada para cada palavra encontrada.
+// Deve retornar true para continuar ou false para interromper a listagem.
+typedef bool (*VisitarPalavra)(NoAuto* final, void* contexto);
+
+bool percorrerSubarvore(NoAuto* no, VisitarPalavra visitar, void* contexto) {
+    if (no->frequencia > 0 && !visitar(no, contexto)) return false;
+    for (int i = 0; i < TAM_ALFABETO; i++) {
+        if (no->filhos[i] != NULL && !percorrerSubarvore(no->filhos[i], visitar, contexto)) return false;
+    }
+    return true;
+}
+
+void listarPrefixo(NoAuto* raiz, char* prefixo, VisitarPalavra visitar, void* contexto) {
+    NoAuto* no = buscarNoPrefixo(raiz, prefixo);
+    if (no != NULL) percorrerSubarvore(no, visitar, contexto);
+}
+
+// Libera memória da Trie (Recursivo)
+void liberarNoAuto(NoAuto* raiz) {
+    if (raiz == NULL) return;
+    for (int i = 0; i < TAM_ALFABETO; i++) {
+        liberarNoAuto(raiz->filhos[i]);
+    }
+    free(raiz->palavra);
+    free(raiz);
+}
+
+// ============================================================================
+// VISITANTES E COMPARAÇÃO
+// ============================================================================
+
+// Visitante: imprime até o limite apontado por contexto e então interrompe
+bool imprimirAteLimite(NoAuto* final, void* contexto) {
+    int* restantes = (int*)contexto;
+    printf("%s ", final->palavra);
+    return --(*restantes) > 0;
+}
+
+// Visitante usado na versão sem cache: mantém os K melhores vendo TODA a subárvore
+typedef struct {
+    NoAuto* melhores[TOP_K];
+    int qtd;
+} RankingParcial;
+
+bool coletarMelhores(NoAuto* final, void* contexto) {
+    RankingParcial* r = (RankingParcial*)contexto;
+    int pos;
+    if (r->qtd < TOP_K) pos = r->qtd++;
+    else if (vemAntes(final, r->melhores[TOP_K - 1])) pos = TOP_K - 1;
+    else return true;
+    r->melhores[pos] = final;
+    while (pos > 0 && vemAntes(r->melhores[pos], r->melhores[pos - 1])) {
+        NoAuto* temp = r->melhores[pos];
+        r->melhores[pos] = r->melhores[pos - 1];
+        r->melhores[pos - 1] = temp;
+        pos--;
+    }
+    return true;
+}
+
+// Gera palavras juntando sílabas, o que cria prefixos compartilhados
+char* gerarPalavra(char* destino) {
+    const char* silabas[] = {
+        "ca", "sa", "ro", "mi", "nha", "de", "to", "pe", "li", "ra",
+        "bo", "ma", "te", "co", "la", "ve", "ne", "di", "so", "pa",
+        "men", "tra", "gu", "fi", "cao", "ar", "es", "in", "con", "por"
+    };
+    int qtdSilabas = sizeof(silabas) / sizeof(silabas[0]);
+    destino[0] = '\0';
+    int partes = 2 + rand() % 5;
+    for (int p = 0; p < partes; p++) strcat(destino, silabas[rand() % qtdSilabas]);
+    return destino;
+}
+
+int main() {
+    printf("========================================================\n");
+    printf("       TRIE: AUTOCOMPLETAR COM TOP-%d POR FREQUENCIA\n", TOP_K);
+    printf("========================================================\n");
+
+    // ------------------------------------------------------------
+    // TESTE 1: Exemplo pequeno
+    // ------------------------------------------------------------
+    NoAuto* raiz = criarNoAuto();
+    registrarPalavra(raiz, "casa", 50);
+    registrarPalavra(raiz, "carro", 120);
+    registrarPalavra(raiz, "caminhao", 30);
+    registrarPalavra(raiz, "caminho", 80);
+    registrarPalavra(raiz, "cama", 10);
+    registrarPalavra(raiz, "arvore", 5);
+    registrarPalavra(raiz, "cama", 100); // "cama" passa a ser a mais buscada depois de "carro"
+
+    NoAuto* sugestoes[TOP_K];
+    char* prefixos[] = {"ca", "cam", "caminh", "x"};
+    for (int p = 0; p < 4; p++) {
+        int qtd = autocompletar(raiz, prefixos[p], sugestoes, TOP_K);
+        printf("Sugestões para '%s': ", prefixos[p]);
+        if (qtd == 0) printf("(nenhuma)");
+        for (int i = 0; i < qtd; i++) printf("%s(%ld) ", sugestoes[i]->palavra, sugestoes[i]->frequencia);
+        printf("\n");
+    }
+
+    int limite = 3;
+    printf("Primeiras %d em ordem alfabética com 'ca': ", limite);
+    listarPrefixo(raiz, "ca", imprimirAteLimite, &limite);
+    printf("\n");
+    liberarNoAuto(raiz);
+
+    // ------------------------------------------------------------
+    // TESTE 2: Latência com muitas palavras por prefixo
+    // ------------------------------------------------------------
+    int qtdPalavras = 300000, qtdConsultas = 1000000;
+    printf("\n--- %d palavras, frequências com cauda longa ---\n", qtdPalavras);
+
+    srand(42);
+    raiz = criarNoAuto();
+    char palavra[TAM_PALAVRA];
+    clock_t inicio = clock();
+    for (int i = 0; i < qtdPalavras; i++) {
+        // Poucas palavras muito frequentes, muitas raras
+        long freq = 1 + (long)(100000.0 / (1 + rand() % 10000));
+        registrarPalavra(raiz, gerarPalavra(palavra), freq);
+    }
+    clock_t fim = clock();
+    printf("Construção: %f segundos\n", ((double)(fim - inicio)) / CLOCKS_PER_SEC);
+
+    // Prefixos curtos (1 a 3 letras) têm subárvores enormes
+    char (*consultas)[4] = malloc(qtdConsultas * sizeof(*consultas));
+    for (int i = 0; i < qtdConsultas; i++) {
+        gerarPalavra(palavra);
+        int tam = 1 + rand() % 3;
+        memcpy(consultas[i], palavra, tam);
+        consultas[i][tam] = '\0';
+    }
+
+    long total = 0;
+    inicio = clock();
+    for (int i = 0; i < qtdConsultas; i++) total += autocompletar(raiz, consultas[i], sugestoes, TOP_K);
+    fim = clock();
+    double tempoCache = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    // Sem cache: percorre a subárvore inteira (apenas algumas consultas, é lento)
+    int qtdSemCache = 200;
+    int divergencias = 0;
+    inicio = clock();
+    for (int i = 0; i < qtdSemCache; i++) {
+        RankingParcial r;
+        r.qtd = 0;
+        listarPrefixo(raiz, consultas[i], coletarMelhores, &r);
+        int qtd = autocompletar(raiz, consultas[i], sugestoes, TOP_K);
+        if (qtd != r.qtd) divergencias++;
+        for (int j = 0; j < qtd && j < r.qtd; j++) {
+            if (sugestoes[j] != r.melhores[j]) { divergencias++; break; }
+        }
+    }
+    fim = clock();
+    double tempoSemCache = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    printf("Com cache: %.1f ns por consulta (%ld sugestões)\n", tempoCache * 1e9 / qtdConsultas, total);
+    printf("Percorrendo a subárvore: %.1f ns por consulta\n", tempoSemCache * 1e9 / qtdSemCache);
+    printf("Rankings %s\n", divergencias == 0 ? "CONFEREM" : "DIVERGEM (ERRO!)");
+
+    free(consultas);
+    liberarNoAuto(raiz);
+    printf("\nMemoria liberada. Fim do programa.\n");
+    return 0;
+}
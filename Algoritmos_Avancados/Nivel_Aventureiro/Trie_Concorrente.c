@@ -0,0 +1,473 @@
+/*
+ * Objetivo: Trie (mesmo nó com mapa de bits do BST_TRIE.c) lida por várias
+ *           threads ao mesmo tempo em que uma thread escritora insere palavras.
+ *
+ * Ideia (estilo RCU - Read-Copy-Update):
+ * - O mapa de bits e o vetor denso de filhos de cada nó ficam juntos em um
+ *   BLOCO imutável. Para adicionar um filho, o escritor monta um bloco novo
+ *   (cópia + filho novo) e troca o ponteiro do nó com um store "release".
+ * - O leitor carrega o ponteiro do bloco com "acquire", então sempre enxerga
+ *   um bloco completo: mapa e filhos sempre concordam. Leitores nunca travam.
+ * - O bloco antigo não pode ser liberado na hora, porque algum leitor pode
+ *   estar no meio dele. Ele é "aposentado" com a época atual e só é liberado
+ *   quando nenhum leitor ativo entrou antes dessa época (reciclagem por épocas).
+ * - O sufixo novo de uma palavra é montado inteiro antes de ser ligado à
+ *   árvore, então um leitor nunca vê um caminho pela metade.
+ *
+ * Restrição: um único escritor por vez (várias threads escritoras precisariam
+ * de uma trava entre elas; os leitores continuariam sem trava).
+ *
+ * A execução compara os leitores sem trava com leitores usando
+ * pthread_rwlock na mesma carga.
+ *
+ * Compilação: gcc -O2 -pthread Trie_Concorrente.c -o Trie_Concorrente
+ * Uso: ./Trie_Concorrente [qtd_leitores]
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE // pthread_rwlockattr_setkind_np
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define MAX_LEITORES 64
+#define LIMITE_APOSENTADOS 64   // Tenta reciclar a cada 64 blocos aposentados
+#define INATIVO UINT64_MAX      // Época de um leitor fora de uma leitura
+
+// ============================================================================
+// ESTRUTURA: NÓ E BLOCO DE FILHOS
+// ============================================================================
+
+struct NoTrieC;
+
+typedef struct BlocoFilhos {
+    struct BlocoFilhos* proximoAposentado; // Usados só depois de aposentado
+    uint64_t epocaAposentado;
+    uint64_t mapa[4];                      // 256 bits: bit b ligado = existe filho para o byte b
+    unsigned short qtdFilhos;
+    struct NoTrieC* filhos[];              // Somente os filhos que existem, em ordem de byte
+} BlocoFilhos;
+
+typedef struct NoTrieC {
+    _Atomic(BlocoFilhos*) bloco; // NULL enquanto o nó não tem filhos
+    atomic_bool fimDaPalavra;
+} NoTrieC;
+
+// Época anunciada por um leitor. Cada uma ocupa sua própria linha de cache
+// para as threads não disputarem a mesma linha ao entrar e sair.
+typedef struct {
+    _Atomic uint64_t epoca;
+    char preenchimento[64 - sizeof(uint64_t)];
+} SlotLeitor;
+
+typedef struct {
+    NoTrieC* raiz;
+    _Atomic uint64_t epocaGlobal;
+    SlotLeitor leitores[MAX_LEITORES];
+    // Estado do escritor (só ele acessa)
+    BlocoFilhos* aposentados;
+    int qtdAposentados;
+    long totalAposentados;
+    long totalLiberados;
+} TrieConcorrente;
+
+// Auxiliar: quantidade de bits ligados em uma palavra de 64 bits
+int contarBits(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int total = 0;
+    while (x) { x &= x - 1; total++; }
+    return total;
+#endif
+}
+
+// Auxiliar: posição do filho do byte b no vetor denso do bloco
+int posicaoFilho(BlocoFilhos* bloco, int b) {
+    int palavra = b >> 6;
+    uint64_t antes = bloco->mapa[palavra] & ((1ULL << (b & 63)) - 1);
+    int pos = contarBits(antes);
+    for (int i = 0; i < palavra; i++) pos += contarBits(bloco->mapa[i]);
+    return pos;
+}
+
+// Auxiliar: retorna o filho do byte b ou NULL (seguro para leitores)
+NoTrieC* obterFilho(NoTrieC* no, int b) {
+    BlocoFilhos* bloco = atomic_load_explicit(&no->bloco, memory_order_acquire);
+    if (bloco == NULL || !(bloco->mapa[b >> 6] & (1ULL << (b & 63)))) return NULL;
+    return bloco->filhos[posicaoFilho(bloco, b)];
+}
+
+// Auxiliar: Converte char para índice (0 a 255), igual ao BST_TRIE.c
+int charParaIndice(char c) {
+    unsigned char b = (unsigned char)c;
+    if (b < 128) return tolower(b);
+    return b;
+}
+
+NoTrieC* criarNoTrieC() {
+    NoTrieC* novo = (NoTrieC*)malloc(sizeof(NoTrieC));
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    atomic_init(&novo->bloco, NULL);
+    atomic_init(&novo->fimDaPalavra, false);
+    return novo;
+}
+
+// Cria um bloco com os filhos de 'antigo' mais 'filho' no byte b (antigo pode ser NULL)
+BlocoFilhos* copiarComFilho(BlocoFilhos* antigo, int b, NoTrieC* filho) {
+    int qtd = antigo ? antigo->qtdFilhos : 0;
+    BlocoFilhos* novo = (BlocoFilhos*)malloc(sizeof(BlocoFilhos) + (qtd + 1) * sizeof(NoTrieC*));
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    novo->proximoAposentado = NULL;
+    novo->epocaAposentado = 0;
+    for (int i = 0; i < 4; i++) novo->mapa[i] = antigo ? antigo->mapa[i] : 0;
+    int pos = antigo ? posicaoFilho(antigo, b) : 0;
+    if (antigo) {
+        memcpy(novo->filhos, antigo->filhos, pos * sizeof(NoTrieC*));
+        memcpy(&novo->filhos[pos + 1], &antigo->filhos[pos], (qtd - pos) * sizeof(NoTrieC*));
+    }
+    novo->filhos[pos] = filho;
+    novo->qtdFilhos = qtd + 1;
+    novo->mapa[b >> 6] |= 1ULL << (b & 63);
+    return novo;
+}
+
+TrieConcorrente* criarTrieConcorrente() {
+    TrieConcorrente* trie = (TrieConcorrente*)malloc(sizeof(TrieConcorrente));
+    if (trie == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    trie->raiz = criarNoTrieC();
+    atomic_init(&trie->epocaGlobal, 1);
+    for (int i = 0; i < MAX_LEITORES; i++) atomic_init(&trie->leitores[i].epoca, INATIVO);
+    trie->aposentados = NULL;
+    trie->qtdAposentados = 0;
+    trie->totalAposentados = 0;
+    trie->totalLiberados = 0;
+    return trie;
+}
+
+// ============================================================================
+// LEITORES
+// ============================================================================
+
+// Anuncia que o leitor 'id' vai começar a percorrer a Trie.
+// A barreira seq_cst garante que o escritor veja o anúncio antes de
+// decidir liberar um bloco que este leitor ainda pode alcançar.
+void entrarLeitura(TrieConcorrente* trie, int id) {
+    uint64_t epoca = atomic_load_explicit(&trie->epocaGlobal, memory_order_relaxed);
+    atomic_store_explicit(&trie->leitores[id].epoca, epoca, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+// Fim da leitura: nenhum ponteiro obtido dentro dela pode ser usado depois
+void sairLeitura(TrieConcorrente* trie, int id) {
+    atomic_store_explicit(&trie->leitores[id].epoca, INATIVO, memory_order_release);
+}
+
+// Busca uma palavra exata. Deve ser chamada entre entrarLeitura e sairLeitura.
+bool buscarTrieConcorrente(TrieConcorrente* trie, char* palavra) {
+    NoTrieC* atual = trie->raiz;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        atual = obterFilho(atual, charParaIndice(palavra[i]));
+        if (atual == NULL) return false;
+    }
+    return atomic_load_explicit(&atual->fimDaPalavra, memory_order_acquire);
+}
+
+// ============================================================================
+// ESCRITOR (ÚNICO)
+// ============================================================================
+
+// Libera os blocos aposentados antes da época do leitor ativo mais antigo
+void reciclarAposentados(TrieConcorrente* trie) {
+    // Avança a época: leitores que entrarem daqui em diante não alcançam
+    // nenhum bloco que já está na lista.
+    atomic_fetch_add_explicit(&trie->epocaGlobal, 1, memory_order_seq_cst);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    uint64_t maisAntiga = INATIVO;
+    for (int i = 0; i < MAX_LEITORES; i++) {
+        uint64_t e = atomic_load_explicit(&trie->leitores[i].epoca, memory_order_acquire);
+        if (e < maisAntiga) maisAntiga = e;
+    }
+
+    BlocoFilhos** ref = &trie->aposentados;
+    while (*ref != NULL) {
+        BlocoFilhos* bloco = *ref;
+        if (bloco->epocaAposentado < maisAntiga) {
+            *ref = bloco->proximoAposentado;
+            free(bloco);
+            trie->qtdAposentados--;
+            trie->totalLiberados++;
+        } else {
+            ref = &bloco->proximoAposentado;
+        }
+    }
+}
+
+// Guarda um bloco que acabou de ser desligado da árvore
+void aposentarBloco(TrieConcorrente* trie, BlocoFilhos* bloco) {
+    atomic_thread_fence(memory_order_seq_cst); // A troca do ponteiro vem antes da época lida
+    bloco->epocaAposentado = atomic_load_explicit(&trie->epocaGlobal, memory_order_relaxed);
+    bloco->proximoAposentado = trie->aposentados;
+    trie->aposentados = bloco;
+    trie->qtdAposentados++;
+    trie->totalAposentados++;
+    if (trie->qtdAposentados >= LIMITE_APOSENTADOS) reciclarAposentados(trie);
+}
+
+// Insere uma palavra. Apenas uma thread pode chamar por vez.
+void inserirTrieConcorrente(TrieConcorrente* trie, char* palavra) {
+    // 1. Desce enquanto o caminho já existe
+    NoTrieC* atual = trie->raiz;
+    int i = 0;
+    for (; palavra[i] != '\0'; i++) {
+        NoTrieC* proximo = obterFilho(atual, charParaIndice(palavra[i]));
+        if (proximo == NULL) break;
+        atual = proximo;
+    }
+    if (palavra[i] == '\0') {
+        atomic_store_explicit(&atual->fimDaPalavra, true, memory_order_release);
+        return;
+    }
+
+    // 2. Monta o sufixo que falta de trás para frente, ainda invisível aos leitores
+    int tam = (int)strlen(palavra);
+    NoTrieC* sufixo = criarNoTrieC();
+    atomic_init(&sufixo->fimDaPalavra, true);
+    for (int j = tam - 1; j > i; j--) {
+        NoTrieC* pai = criarNoTrieC();
+        atomic_init(&pai->bloco, copiarComFilho(NULL, charParaIndice(palavra[j]), sufixo));
+        sufixo = pai;
+    }
+
+    // 3. Publica: um único store release liga o sufixo inteiro à árvore
+    BlocoFilhos* antigo = atomic_load_explicit(&atual->bloco, memory_order_relaxed);
+    BlocoFilhos* novo = copiarComFilho(antigo, charParaIndice(palavra[i]), sufixo);
+    atomic_store_explicit(&atual->bloco, novo, memory_order_release);
+    if (antigo != NULL) aposentarBloco(trie, antigo);
+}
+
+// Libera tudo. Só pode ser chamada quando nenhuma outra thread usa a Trie.
+void liberarNoTrieC(NoTrieC* no) {
+    BlocoFilhos* bloco = atomic_load_explicit(&no->bloco, memory_order_relaxed);
+    if (bloco != NULL) {
+        for (int i = 0; i < bloco->qtdFilhos; i++) liberarNoTrieC(bloco->filhos[i]);
+        free(bloco);
+    }
+    free(no);
+}
+
+void liberarTrieConcorrente(TrieConcorrente* trie) {
+    while (trie->aposentados != NULL) {
+        BlocoFilhos* prox = trie->aposentados->proximoAposentado;
+        free(trie->aposentados);
+        trie->aposentados = prox;
+    }
+    liberarNoTrieC(trie->raiz);
+    free(trie);
+}
+
+// ============================================================================
+// DEMONSTRAÇÃO: LEITORES x ESCRITOR
+// ============================================================================
+
+typedef struct {
+    TrieConcorrente* trie;
+    pthread_rwlock_t* trava; // NULL = leitura sem trava (épocas)
+    int id;
+    char** base;             // Palavras inseridas antes de começar: sempre presentes
+    char** ausentes;         // Palavras que nunca são inseridas
+    int qtdBase;
+    atomic_bool* parar;
+    long buscas;
+    long erros;
+} ArgsLeitor;
+
+typedef struct {
+    TrieConcorrente* trie;
+    pthread_rwlock_t* trava;
+    char** novas;
+    int qtdNovas;
+    atomic_bool* parar;
+} ArgsEscritor;
+
+void* executarLeitor(void* arg) {
+    ArgsLeitor* a = (ArgsLeitor*)arg;
+    unsigned int semente = 1234u + a->id;
+    while (!atomic_load_explicit(a->parar, memory_order_relaxed)) {
+        for (int k = 0; k < 256; k++) {
+            semente = semente * 1103515245u + 12345u;
+            int i = (int)((semente >> 8) % (unsigned)a->qtdBase);
+            bool achouBase, achouAusente;
+            if (a->trava) {
+                pthread_rwlock_rdlock(a->trava);
+                achouBase = buscarTrieConcorrente(a->trie, a->base[i]);
+                achouAusente = buscarTrieConcorrente(a->trie, a->ausentes[i]);
+                pthread_rwlock_unlock(a->trava);
+            } else {
+                entrarLeitura(a->trie, a->id);
+                achouBase = buscarTrieConcorrente(a->trie, a->base[i]);
+                achouAusente = buscarTrieConcorrente(a->trie, a->ausentes[i]);
+                sairLeitura(a->trie, a->id);
+            }
+            if (!achouBase || achouAusente) a->erros++;
+            a->buscas += 2;
+        }
+    }
+    return NULL;
+}
+
+void* executarEscritor(void* arg) {
+    ArgsEscritor* a = (ArgsEscritor*)arg;
+    for (int i = 0; i < a->qtdNovas; i++) {
+        if (a->trava) pthread_rwlock_wrlock(a->trava);
+        inserirTrieConcorrente(a->trie, a->novas[i]);
+        if (a->trava) pthread_rwlock_unlock(a->trava);
+    }
+    atomic_store(a->parar, true);
+    return NULL;
+}
+
+// Palavras de 2 a 6 sílabas
+void gerarPalavra(char* destino, unsigned int* semente) {
+    const char* silabas[] = {
+        "ca", "sa", "ro", "mi", "nha", "de", "to", "pe", "li", "ra",
+        "bo", "ma", "te", "co", "la", "ve", "ne", "di", "so", "pa",
+        "men", "tra", "gu", "fi", "ção", "ar", "es", "in", "con", "por"
+    };
+    destino[0] = '\0';
+    *semente = *semente * 1103515245u + 12345u;
+    int partes = 2 + (int)((*semente >> 8) % 5);
+    for (int p = 0; p < partes; p++) {
+        *semente = *semente * 1103515245u + 12345u;
+        strcat(destino, silabas[(*semente >> 8) % 30]);
+    }
+}
+
+double agoraSegundos() {
+    struct timespec t;
+    timespec_get(&t, TIME_UTC);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+void executarRodada(const char* titulo, bool comTrava, int qtdLeitores,
+                    char** base, char** ausentes, int qtdBase, char** novas, int qtdNovas) {
+    TrieConcorrente* trie = criarTrieConcorrente();
+    for (int i = 0; i < qtdBase; i++) inserirTrieConcorrente(trie, base[i]);
+
+    // Por padrão a rwlock da glibc prefere leitores: com leitores em laço o
+    // escritor nunca conseguiria a trava. Pedimos preferência ao escritor.
+    pthread_rwlock_t trava;
+    pthread_rwlockattr_t atributos;
+    pthread_rwlockattr_init(&atributos);
+#ifdef __GLIBC__
+    pthread_rwlockattr_setkind_np(&atributos, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+    pthread_rwlock_init(&trava, &atributos);
+    pthread_rwlockattr_destroy(&atributos);
+    atomic_bool parar;
+    atomic_init(&parar, false);
+
+    ArgsLeitor args[MAX_LEITORES];
+    pthread_t threads[MAX_LEITORES];
+    for (int t = 0; t < qtdLeitores; t++) {
+        args[t] = (ArgsLeitor){trie, comTrava ? &trava : NULL, t, base, ausentes, qtdBase, &parar, 0, 0};
+    }
+    ArgsEscritor escritor = {trie, comTrava ? &trava : NULL, novas, qtdNovas, &parar};
+
+    double inicio = agoraSegundos();
+    for (int t = 0; t < qtdLeitores; t++) pthread_create(&threads[t], NULL, executarLeitor, &args[t]);
+    pthread_t threadEscritor;
+    pthread_create(&threadEscritor, NULL, executarEscritor, &escritor);
+    pthread_join(threadEscritor, NULL);
+    double tempoEscrita = agoraSegundos() - inicio;
+    for (int t = 0; t < qtdLeitores; t++) pthread_join(threads[t], NULL);
+    double tempoTotal = agoraSegundos() - inicio;
+
+    long buscas = 0, erros = 0;
+    for (int t = 0; t < qtdLeitores; t++) {
+        buscas += args[t].buscas;
+        erros += args[t].erros;
+    }
+    long faltando = 0;
+    for (int i = 0; i < qtdNovas; i++) faltando += !buscarTrieConcorrente(trie, novas[i]);
+
+    printf("\n--- %s ---\n", titulo);
+    printf("Escritor: %d insercoes em %.3f s (%.0f por segundo)\n",
+           qtdNovas, tempoEscrita, qtdNovas / tempoEscrita);
+    printf("Leitores: %ld buscas em %.3f s (%.1f milhoes por segundo)\n",
+           buscas, tempoTotal, buscas / tempoTotal / 1e6);
+    printf("Respostas erradas durante as insercoes: %ld | Palavras novas faltando: %ld\n", erros, faltando);
+    if (!comTrava) {
+        printf("Blocos aposentados: %ld | liberados durante a execucao: %ld | pendentes: %d\n",
+               trie->totalAposentados, trie->totalLiberados, trie->qtdAposentados);
+    }
+
+    pthread_rwlock_destroy(&trava);
+    liberarTrieConcorrente(trie);
+}
+
+int main(int argc, char* argv[]) {
+    int qtdLeitores = 4;
+    if (argc > 1) qtdLeitores = atoi(argv[1]);
+    if (qtdLeitores < 1 || qtdLeitores > MAX_LEITORES) qtdLeitores = 4;
+
+    int qtdBase = 100000, qtdNovas = 500000;
+    char** base = (char**)malloc(qtdBase * sizeof(char*));
+    char** ausentes = (char**)malloc(qtdBase * sizeof(char*));
+    char** novas = (char**)malloc(qtdNovas * sizeof(char*));
+    if (base == NULL || ausentes == NULL || novas == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    unsigned int semente = 42;
+    for (int i = 0; i < qtdBase; i++) {
+        base[i] = (char*)malloc(64);
+        ausentes[i] = (char*)malloc(64);
+        gerarPalavra(base[i], &semente);
+        // '#' nunca aparece nas sílabas, então essa palavra nunca é inserida
+        sprintf(ausentes[i], "%s#", base[i]);
+    }
+    for (int i = 0; i < qtdNovas; i++) {
+        novas[i] = (char*)malloc(64);
+        gerarPalavra(novas[i], &semente);
+    }
+
+    printf("========================================================\n");
+    printf("   TRIE CONCORRENTE: %d LEITORES + 1 ESCRITOR\n", qtdLeitores);
+    printf("========================================================\n");
+    printf("Base: %d palavras | Novas inseridas durante a leitura: %d\n", qtdBase, qtdNovas);
+    fflush(stdout);
+
+    executarRodada("Leitores sem trava (RCU + epocas)", false, qtdLeitores,
+                   base, ausentes, qtdBase, novas, qtdNovas);
+    executarRodada("Leitores com pthread_rwlock", true, qtdLeitores,
+                   base, ausentes, qtdBase, novas, qtdNovas);
+
+    for (int i = 0; i < qtdBase; i++) {
+        free(base[i]);
+        free(ausentes[i]);
+    }
+    for (int i = 0; i < qtdNovas; i++) free(novas[i]);
+    free(base);
+    free(ausentes);
+    free(novas);
+    printf("\nFim do programa.\n");
+    return 0;
+}
@@ -0,0 +1,458 @@
+/*
+ * Objetivo: Contar a frequência de cada palavra de um arquivo de texto grande
+ *           (vários GB) usando várias threads e a Trie do BST_TRIE.c.
+ *
+ * Pipeline:
+ * 1. O arquivo é dividido em N faixas de bytes, uma por thread.
+ * 2. Cada thread lê a sua faixa em blocos de 1 MB, separa as palavras e conta
+ *    em uma Trie própria (nenhuma trava durante a contagem). No lugar de
+ *    fimDaPalavra, o nó final guarda quantas vezes a palavra apareceu.
+ *    Uma palavra que atravessa a fronteira entre duas faixas pertence à
+ *    faixa onde ela começa.
+ * 3. No fim, as Tries são mescladas duas a duas em paralelo (log2(N) rodadas).
+ *    Subárvores que só existem em uma das Tries são movidas sem cópia.
+ *
+ * Palavra: sequência de letras/dígitos ASCII ou bytes >= 128 (UTF-8).
+ * Letras ASCII viram minúsculas, como no charParaIndice do BST_TRIE.c.
+ *
+ * Compilação: gcc -O2 -pthread Trie_Contagem_Paralela.c -o Trie_Contagem_Paralela
+ * Uso: ./Trie_Contagem_Paralela [arquivo.txt] [qtd_threads]
+ *      Sem arquivo, um texto sintético de ~200 MB é gerado e apagado no fim.
+ */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L // fseeko/ftello com -std=c11
+#endif
+#define _FILE_OFFSET_BITS 64    // off_t de 64 bits: arquivos acima de 2 GB em sistemas de 32 bits
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#define fseeko _fseeki64 // Posições acima de 2 GB
+#define ftello _ftelli64
+#endif
+
+#define MAX_THREADS 64
+#define TAM_BLOCO (1 << 20)   // Bytes lidos por vez de cada faixa
+#define TAM_MAX_PALAVRA 100   // Palavras maiores são ignoradas
+#define TOP_K 10              // Palavras mais frequentes exibidas no fim
+
+// ============================================================================
+// ESTRUTURA: TRIE DE CONTAGEM (NoTrie do BST_TRIE.c com contador)
+// ============================================================================
+
+typedef struct NoTrie {
+    uint64_t mapa[4];         // 256 bits: bit b ligado = existe filho para o byte b
+    struct NoTrie** filhos;   // Somente os filhos que existem, em ordem crescente de byte
+    unsigned short qtdFilhos; // Tamanho do vetor filhos
+    long ocorrencias;         // Vezes que a palavra terminada aqui apareceu (0 = não é palavra)
+} NoTrie;
+
+// Auxiliar: quantidade de bits ligados em uma palavra de 64 bits
+int contarBits(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int total = 0;
+    while (x) { x &= x - 1; total++; }
+    return total;
+#endif
+}
+
+// Auxiliar: índice do bit ligado mais baixo (x != 0)
+int indiceMenorBit(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int i = 0;
+    while (!(x & 1)) { x >>= 1; i++; }
+    return i;
+#endif
+}
+
+// Auxiliar: posição do filho do byte b no vetor denso
+int posicaoFilho(NoTrie* no, int b) {
+    int palavra = b >> 6;
+    uint64_t antes = no->mapa[palavra] & ((1ULL << (b & 63)) - 1);
+    int pos = contarBits(antes);
+    for (int i = 0; i < palavra; i++) pos += contarBits(no->mapa[i]);
+    return pos;
+}
+
+// Auxiliar: retorna o filho do byte b ou NULL
+NoTrie* obterFilho(NoTrie* no, int b) {
+    if (!(no->mapa[b >> 6] & (1ULL << (b & 63)))) return NULL;
+    return no->filhos[posicaoFilho(no, b)];
+}
+
+NoTrie* criarNoTrie() {
+    NoTrie* novo = (NoTrie*)calloc(1, sizeof(NoTrie));
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    return novo;
+}
+
+// Auxiliar: coloca um nó já existente como filho do byte b (mantém o vetor ordenado)
+void anexarFilho(NoTrie* no, int b, NoTrie* filho) {
+    NoTrie** novos = (NoTrie**)realloc(no->filhos, (no->qtdFilhos + 1) * sizeof(NoTrie*));
+    if (novos == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    int pos = posicaoFilho(no, b);
+    memmove(&novos[pos + 1], &novos[pos], (no->qtdFilhos - pos) * sizeof(NoTrie*));
+    novos[pos] = filho;
+    no->filhos = novos;
+    no->qtdFilhos++;
+    no->mapa[b >> 6] |= 1ULL << (b & 63);
+}
+
+// Soma 'quantidade' ocorrências da palavra (bytes já normalizados, tamanho 'tam')
+void contarPalavra(NoTrie* raiz, const unsigned char* palavra, int tam, long quantidade) {
+    NoTrie* atual = raiz;
+    for (int i = 0; i < tam; i++) {
+        NoTrie* proximo = obterFilho(atual, palavra[i]);
+        if (proximo == NULL) {
+            proximo = criarNoTrie();
+            anexarFilho(atual, palavra[i], proximo);
+        }
+        atual = proximo;
+    }
+    atual->ocorrencias += quantidade;
+}
+
+// Soma 'origem' em 'destino'. A Trie de origem deixa de existir:
+// subárvores ausentes no destino são movidas e o restante é liberado.
+void mesclarTries(NoTrie* destino, NoTrie* origem) {
+    destino->ocorrencias += origem->ocorrencias;
+    int k = 0;
+    for (int p = 0; p < 4; p++) {
+        uint64_t bits = origem->mapa[p];
+        while (bits) {
+            int b = p * 64 + indiceMenorBit(bits);
+            bits &= bits - 1;
+            NoTrie* filhoOrigem = origem->filhos[k++];
+            NoTrie* filhoDestino = obterFilho(destino, b);
+            if (filhoDestino == NULL) {
+                anexarFilho(destino, b, filhoOrigem); // Move a subárvore inteira
+            } else {
+                mesclarTries(filhoDestino, filhoOrigem);
+            }
+        }
+    }
+    free(origem->filhos);
+    free(origem);
+}
+
+// Conta palavras distintas e o total de ocorrências
+void resumirTrie(NoTrie* no, long* distintas, long* total) {
+    if (no->ocorrencias > 0) {
+        (*distintas)++;
+        *total += no->ocorrencias;
+    }
+    for (int i = 0; i < no->qtdFilhos; i++) resumirTrie(no->filhos[i], distintas, total);
+}
+
+void liberarTrie(NoTrie* raiz) {
+    if (raiz == NULL) return;
+    for (int i = 0; i < raiz->qtdFilhos; i++) liberarTrie(raiz->filhos[i]);
+    free(raiz->filhos);
+    free(raiz);
+}
+
+// --- Palavras mais frequentes ---
+
+typedef struct {
+    char palavra[TAM_MAX_PALAVRA + 1];
+    long ocorrencias;
+} Frequente;
+
+typedef struct {
+    Frequente itens[TOP_K]; // Ordenado do mais frequente para o menos
+    int qtd;
+} Ranking;
+
+// Auxiliar recursivo: percorre a Trie remontando as palavras no buffer
+void coletarFrequentes(NoTrie* no, char* buffer, int tam, Ranking* ranking) {
+    if (no->ocorrencias > 0 &&
+        (ranking->qtd < TOP_K || no->ocorrencias > ranking->itens[TOP_K - 1].ocorrencias)) {
+        int pos = (ranking->qtd < TOP_K) ? ranking->qtd++ : TOP_K - 1;
+        // Desloca os menos frequentes para abrir espaço (insertion sort)
+        while (pos > 0 && ranking->itens[pos - 1].ocorrencias < no->ocorrencias) {
+            ranking->itens[pos] = ranking->itens[pos - 1];
+            pos--;
+        }
+        memcpy(ranking->itens[pos].palavra, buffer, tam);
+        ranking->itens[pos].palavra[tam] = '\0';
+        ranking->itens[pos].ocorrencias = no->ocorrencias;
+    }
+    if (tam >= TAM_MAX_PALAVRA) return;
+    int k = 0;
+    for (int p = 0; p < 4; p++) {
+        uint64_t bits = no->mapa[p];
+        while (bits) {
+            buffer[tam] = (char)(p * 64 + indiceMenorBit(bits));
+            bits &= bits - 1;
+            coletarFrequentes(no->filhos[k++], buffer, tam + 1, ranking);
+        }
+    }
+}
+
+// ============================================================================
+// PIPELINE PARALELO
+// ============================================================================
+
+typedef struct {
+    const char* caminho;
+    long long inicio;   // Primeiro byte da faixa
+    long long fim;      // Primeiro byte depois da faixa
+    NoTrie* raiz;       // Trie própria da thread
+    long long lidos;    // Bytes lidos (inclui o final da última palavra)
+    bool erro;
+} Faixa;
+
+// Auxiliar: true se o byte faz parte de uma palavra
+static inline bool ehLetra(unsigned char c) {
+    return c >= 128 || isalnum(c);
+}
+
+// Conta as palavras que começam dentro da faixa [inicio, fim)
+void* contarFaixa(void* arg) {
+    Faixa* f = (Faixa*)arg;
+    f->raiz = criarNoTrie();
+    f->lidos = 0;
+    f->erro = false;
+
+    FILE* arquivo = fopen(f->caminho, "rb");
+    unsigned char* bloco = (unsigned char*)malloc(TAM_BLOCO);
+    if (arquivo == NULL || bloco == NULL) {
+        f->erro = true;
+        if (arquivo) fclose(arquivo);
+        free(bloco);
+        return NULL;
+    }
+
+    // Se a faixa começa no meio de uma palavra, essa palavra é da faixa anterior
+    bool pulando = false;
+    if (f->inicio > 0) {
+        fseeko(arquivo, f->inicio - 1, SEEK_SET);
+        int anterior = fgetc(arquivo);
+        pulando = (anterior != EOF && ehLetra((unsigned char)anterior));
+    }
+    fseeko(arquivo, f->inicio, SEEK_SET);
+
+    unsigned char palavra[TAM_MAX_PALAVRA];
+    int tam = 0;
+    bool longaDemais = false;
+    long long pos = f->inicio;
+    bool terminou = false;
+    size_t lidos;
+
+    while (!terminou && (lidos = fread(bloco, 1, TAM_BLOCO, arquivo)) > 0) {
+        for (size_t i = 0; i < lidos; i++, pos++) {
+            unsigned char c = bloco[i];
+            if (ehLetra(c)) {
+                if (pulando) continue;
+                if (tam == 0 && !longaDemais && pos >= f->fim) { terminou = true; break; }
+                if (tam < TAM_MAX_PALAVRA) palavra[tam++] = (c < 128) ? (unsigned char)tolower(c) : c;
+                else longaDemais = true;
+            } else {
+                pulando = false;
+                if (tam > 0 && !longaDemais) contarPalavra(f->raiz, palavra, tam, 1);
+                tam = 0;
+                longaDemais = false;
+                if (pos >= f->fim) { terminou = true; break; }
+            }
+        }
+    }
+    // Fim do arquivo no meio de uma palavra
+    if (!terminou && tam > 0 && !longaDemais) contarPalavra(f->raiz, palavra, tam, 1);
+
+    f->lidos = pos - f->inicio;
+    free(bloco);
+    fclose(arquivo);
+    return NULL;
+}
+
+typedef struct {
+    NoTrie* destino;
+    NoTrie* origem;
+} ParMescla;
+
+void* executarMescla(void* arg) {
+    ParMescla* par = (ParMescla*)arg;
+    mesclarTries(par->destino, par->origem);
+    return NULL;
+}
+
+double agoraSegundos() {
+    struct timespec t;
+    timespec_get(&t, TIME_UTC);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Executa o pipeline completo e retorna a Trie final (NULL em caso de erro)
+NoTrie* contarArquivo(const char* caminho, int qtdThreads, double* tempoContagem, double* tempoMescla) {
+    FILE* arquivo = fopen(caminho, "rb");
+    if (arquivo == NULL) return NULL;
+    fseeko(arquivo, 0, SEEK_END);
+    long long tamanho = ftello(arquivo);
+    fclose(arquivo);
+
+    Faixa faixas[MAX_THREADS];
+    pthread_t threads[MAX_THREADS];
+    double inicio = agoraSegundos();
+    for (int t = 0; t < qtdThreads; t++) {
+        faixas[t].caminho = caminho;
+        faixas[t].inicio = tamanho * t / qtdThreads;
+        faixas[t].fim = tamanho * (t + 1) / qtdThreads;
+        pthread_create(&threads[t], NULL, contarFaixa, &faixas[t]);
+    }
+    bool erro = false;
+    for (int t = 0; t < qtdThreads; t++) {
+        pthread_join(threads[t], NULL);
+        erro = erro || faixas[t].erro;
+    }
+    *tempoContagem = agoraSegundos() - inicio;
+
+    // Mescla em árvore: na rodada com passo p, a Trie t recebe a Trie t + p
+    inicio = agoraSegundos();
+    for (int passo = 1; passo < qtdThreads; passo *= 2) {
+        ParMescla pares[MAX_THREADS];
+        int qtdPares = 0;
+        for (int t = 0; t + passo < qtdThreads; t += 2 * passo) {
+            pares[qtdPares].destino = faixas[t].raiz;
+            pares[qtdPares].origem = faixas[t + passo].raiz;
+            pthread_create(&threads[qtdPares], NULL, executarMescla, &pares[qtdPares]);
+            qtdPares++;
+        }
+        for (int i = 0; i < qtdPares; i++) pthread_join(threads[i], NULL);
+    }
+    *tempoMescla = agoraSegundos() - inicio;
+
+    if (erro) {
+        liberarTrie(faixas[0].raiz);
+        return NULL;
+    }
+    return faixas[0].raiz;
+}
+
+// ============================================================================
+// TEXTO DE TESTE
+// ============================================================================
+
+// Gera um texto com palavras de frequência desigual (as primeiras sílabas
+// aparecem muito mais), pontuação e quebras de linha
+bool gerarTexto(const char* caminho, long long bytesDesejados) {
+    const char* silabas[] = {
+        "de", "ca", "co", "ra", "ta", "ma", "pa", "re", "to", "ni",
+        "li", "men", "te", "sa", "do", "ri", "ção", "es", "con", "ar",
+        "in", "tra", "pro", "ve", "bo", "ne", "gu", "fi", "so", "por"
+    };
+    const char* separadores[] = {" ", " ", " ", " ", ", ", ". ", "\n", " - "};
+    FILE* arquivo = fopen(caminho, "wb");
+    if (arquivo == NULL) return false;
+
+    srand(42);
+    long long escritos = 0;
+    char linha[256];
+    while (escritos < bytesDesejados) {
+        int tam = 0;
+        int partes = 1 + rand() % 4;
+        for (int p = 0; p < partes; p++) {
+            int s = rand() % 30;
+            if (rand() % 2) s = s % 8; // Puxa para as sílabas comuns
+            tam += sprintf(linha + tam, "%s", silabas[s]);
+        }
+        if (rand() % 20 == 0) linha[0] = (char)toupper((unsigned char)linha[0]);
+        tam += sprintf(linha + tam, "%s", separadores[rand() % 8]);
+        fwrite(linha, 1, tam, arquivo);
+        escritos += tam;
+    }
+    fclose(arquivo);
+    return true;
+}
+
+// ============================================================================
+// MAIN: TESTES E COMPARAÇÃO
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    const char* caminho = (argc > 1) ? argv[1] : NULL;
+    int qtdThreads = (argc > 2) ? atoi(argv[2]) : 4;
+    if (qtdThreads < 1 || qtdThreads > MAX_THREADS) qtdThreads = 4;
+
+    printf("========================================================\n");
+    printf("   CONTAGEM DE PALAVRAS EM PARALELO COM TRIES\n");
+    printf("========================================================\n");
+
+    bool textoGerado = false;
+    if (caminho == NULL) {
+        caminho = "texto_sintetico.txt";
+        printf("Gerando '%s' (~200 MB)...\n", caminho);
+        if (!gerarTexto(caminho, 200LL * 1024 * 1024)) {
+            printf("[ERRO] Não foi possível gravar '%s'.\n", caminho);
+            return 1;
+        }
+        textoGerado = true;
+    }
+
+    // Primeiro com 1 thread (referência), depois com qtdThreads
+    int configuracoes[2] = {1, qtdThreads};
+    long distintasRef = -1, totalRef = -1;
+    bool confere = true;
+    for (int c = 0; c < 2; c++) {
+        if (c == 1 && qtdThreads == 1) break;
+        double tempoContagem, tempoMescla;
+        NoTrie* raiz = contarArquivo(caminho, configuracoes[c], &tempoContagem, &tempoMescla);
+        if (raiz == NULL) {
+            printf("[ERRO] Não foi possível ler '%s'.\n", caminho);
+            return 1;
+        }
+        FILE* arquivo = fopen(caminho, "rb");
+        fseeko(arquivo, 0, SEEK_END);
+        double mb = ftello(arquivo) / (1024.0 * 1024.0);
+        fclose(arquivo);
+
+        long distintas = 0, total = 0;
+        resumirTrie(raiz, &distintas, &total);
+        double tempoTotal = tempoContagem + tempoMescla;
+        printf("\n--- %d thread(s) ---\n", configuracoes[c]);
+        printf("Contagem: %.3f s | Mescla: %.3f s | Vazao: %.1f MB/s\n",
+               tempoContagem, tempoMescla, mb / tempoTotal);
+        printf("Palavras: %ld | Distintas: %ld\n", total, distintas);
+
+        if (c == 0) {
+            distintasRef = distintas;
+            totalRef = total;
+            Ranking ranking;
+            ranking.qtd = 0;
+            char buffer[TAM_MAX_PALAVRA + 1];
+            coletarFrequentes(raiz, buffer, 0, &ranking);
+            printf("Mais frequentes:");
+            for (int i = 0; i < ranking.qtd; i++) {
+                printf(" %s(%ld)", ranking.itens[i].palavra, ranking.itens[i].ocorrencias);
+            }
+            printf("\n");
+        } else {
+            confere = (distintas == distintasRef && total == totalRef);
+        }
+        liberarTrie(raiz);
+    }
+    if (qtdThreads > 1) {
+        printf("\nResultados %s\n", confere ? "CONFEREM com a contagem de 1 thread" : "DIVERGEM (ERRO!)");
+    }
+
+    if (textoGerado) remove(caminho);
+    printf("\nFim do programa.\n");
+    return 0;
+}
@@ -0,0 +1,468 @@
+/*
+ * Objetivo: Minimizar a Trie do BST_TRIE.c em um DAWG (Directed Acyclic Word
+ *           Graph), o menor autômato que reconhece as mesmas palavras.
+ *
+ * Ideia: a Trie compartilha prefixos, mas cada sufixo ("-ção", "-mente")
+ * é guardado de novo em todo lugar onde aparece. Duas subárvores são
+ * equivalentes quando aceitam exatamente o mesmo conjunto de restos de
+ * palavra (a mesma "linguagem à direita"). Percorrendo a Trie de baixo para
+ * cima, dois nós são equivalentes se têm a mesma marca de fim de palavra, os
+ * mesmos bytes de saída e (já minimizados) os mesmos filhos. Um registro com
+ * tabela hash guarda um representante de cada classe; o nó repetido é
+ * liberado e o pai passa a apontar para o representante.
+ *
+ * O resultado continua sendo um grafo de NoTrie, então buscarTrie funciona
+ * sem nenhuma mudança. Como agora vários pais dividem o mesmo filho, o DAWG
+ * é somente leitura (inserirTrie nele alteraria outras palavras) e é liberado
+ * pelo registro, não pelo liberarTrie.
+ *
+ * Uso: ./Trie_DAWG [arquivo_de_palavras.txt]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+
+#define TAM_PALAVRA 100 // Tamanho máximo de palavra considerado
+
+// ============================================================================
+// ESTRUTURA 1: TRIE (igual ao BST_TRIE.c) - usada na montagem
+// Lógica: Cada nó representa um byte. O caminho da raiz até um nó forma a palavra.
+// Aceita qualquer byte, então palavras em UTF-8 ("avião") são guardadas como
+// a sequência de bytes de cada caractere.
+// ============================================================================
+
+#define TAM_ALFABETO 256 // Um filho possível para cada valor de byte
+
+typedef struct NoTrie {
+    uint64_t mapa[4];         // 256 bits: bit b ligado = existe filho para o byte b
+    struct NoTrie** filhos;   // Somente os filhos que existem, em ordem crescente de byte
+    unsigned short qtdFilhos; // Tamanho do vetor filhos
+    bool fimDaPalavra;        // Marca se este nó encerra uma palavra válida
+} NoTrie;
+
+// Com 256 ponteiros fixos cada nó teria mais de 2 KB. Aqui o nó tem
+// 32 bytes de mapa + um ponteiro por filho existente.
+
+// Auxiliar: quantidade de bits ligados em uma palavra de 64 bits
+int contarBits(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int total = 0;
+    while (x) { x &= x - 1; total++; }
+    return total;
+#endif
+}
+
+// Auxiliar: posição do filho do byte b no vetor denso.
+// É o número de filhos com byte menor que b (bits ligados antes de b no mapa).
+int posicaoFilho(NoTrie* no, int b) {
+    int palavra = b >> 6;
+    uint64_t antes = no->mapa[palavra] & ((1ULL << (b & 63)) - 1);
+    int pos = contarBits(antes);
+    for (int i = 0; i < palavra; i++) pos += contarBits(no->mapa[i]);
+    return pos;
+}
+
+// Auxiliar: retorna o filho do byte b ou NULL
+NoTrie* obterFilho(NoTrie* no, int b) {
+    if (!(no->mapa[b >> 6] & (1ULL << (b & 63)))) return NULL;
+    return no->filhos[posicaoFilho(no, b)];
+}
+
+// Cria um novo nó para a Trie
+NoTrie* criarNoTrie() {
+    NoTrie* novo = (NoTrie*)malloc(sizeof(NoTrie));
+    if (novo) {
+        novo->fimDaPalavra = false;
+        for (int i = 0; i < 4; i++) {
+            novo->mapa[i] = 0; // Nenhum filho ainda
+        }
+        novo->filhos = NULL;
+        novo->qtdFilhos = 0;
+    }
+    return novo;
+}
+
+// Auxiliar: cria o filho do byte b mantendo o vetor denso ordenado
+NoTrie* adicionarFilho(NoTrie* no, int b) {
+    NoTrie* filho = criarNoTrie();
+    NoTrie** novos = (NoTrie**)realloc(no->filhos, (no->qtdFilhos + 1) * sizeof(NoTrie*));
+    if (filho == NULL || novos == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    int pos = posicaoFilho(no, b);
+    // Abre espaço deslocando os filhos de byte maior uma posição para a direita
+    memmove(&novos[pos + 1], &novos[pos], (no->qtdFilhos - pos) * sizeof(NoTrie*));
+    novos[pos] = filho;
+    no->filhos = novos;
+    no->qtdFilhos++;
+    no->mapa[b >> 6] |= 1ULL << (b & 63);
+    return filho;
+}
+
+// Auxiliar: Converte char para índice (0 a 255).
+// Letras ASCII viram minúsculas; os demais bytes (inclusive UTF-8) são mantidos.
+int charParaIndice(char c) {
+    unsigned char b = (unsigned char)c;
+    if (b < 128) return tolower(b);
+    return b;
+}
+
+// Insere uma palavra na Trie
+void inserirTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+
+        // Se não existe o caminho para esse byte, cria
+        NoTrie* proximo = obterFilho(atual, indice);
+        if (proximo == NULL) {
+            proximo = adicionarFilho(atual, indice);
+        }
+        // Avança para o próximo nó
+        atual = proximo;
+    }
+    // Marca o último nó como fim de uma palavra completa
+    atual->fimDaPalavra = true;
+}
+
+// Busca uma palavra exata na Trie
+bool buscarTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        // Se o caminho for interrompido (NULL), a palavra não existe
+        atual = obterFilho(atual, charParaIndice(palavra[i]));
+        if (atual == NULL) {
+            return false;
+        }
+    }
+    // Retorna true apenas se chegamos ao final E estiver marcado como fim de palavra
+    return (atual != NULL && atual->fimDaPalavra);
+}
+
+// Calcula nós e bytes ocupados pela Trie (sem o cabeçalho interno do malloc)
+void medirTrie(NoTrie* raiz, long* qtdNos, long* bytes) {
+    if (raiz == NULL) return;
+    (*qtdNos)++;
+    *bytes += sizeof(NoTrie) + raiz->qtdFilhos * sizeof(NoTrie*);
+    for (int i = 0; i < raiz->qtdFilhos; i++) {
+        medirTrie(raiz->filhos[i], qtdNos, bytes);
+    }
+}
+
+// Libera memória da Trie (Recursivo)
+void liberarTrie(NoTrie* raiz) {
+    if (raiz == NULL) return;
+    for (int i = 0; i < raiz->qtdFilhos; i++) {
+        liberarTrie(raiz->filhos[i]);
+    }
+    free(raiz->filhos);
+    free(raiz);
+}
+
+
+// ============================================================================
+// ESTRUTURA 2: DAWG (TRIE COM SUFIXOS COMPARTILHADOS)
+// ============================================================================
+
+// Registro de nós únicos: tabela hash com endereçamento aberto (sondagem linear)
+typedef struct {
+    NoTrie** nos;        // NULL = posição livre
+    uint64_t* hashes;    // Hash de cada nó (evita recalcular ao crescer)
+    size_t capacidade;   // Sempre potência de 2
+    size_t qtd;
+} RegistroDAWG;
+
+// Auxiliar: mistura de 64 bits (finalizador do splitmix64)
+uint64_t misturar(uint64_t x) {
+    x ^= x >> 30; x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27; x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// Hash da classe do nó: marca de fim, mapa de bytes e endereços dos filhos.
+// Os filhos já são representantes únicos, então o endereço identifica a subárvore.
+uint64_t assinaturaNo(NoTrie* no) {
+    uint64_t h = misturar(no->fimDaPalavra ? 1 : 2);
+    for (int i = 0; i < 4; i++) h = misturar(h ^ no->mapa[i]);
+    for (int i = 0; i < no->qtdFilhos; i++) h = misturar(h ^ (uint64_t)(uintptr_t)no->filhos[i]);
+    return h;
+}
+
+bool nosEquivalentes(NoTrie* a, NoTrie* b) {
+    if (a->fimDaPalavra != b->fimDaPalavra || a->qtdFilhos != b->qtdFilhos) return false;
+    if (memcmp(a->mapa, b->mapa, sizeof(a->mapa)) != 0) return false;
+    return memcmp(a->filhos, b->filhos, a->qtdFilhos * sizeof(NoTrie*)) == 0;
+}
+
+RegistroDAWG* criarRegistro() {
+    RegistroDAWG* reg = (RegistroDAWG*)malloc(sizeof(RegistroDAWG));
+    if (reg == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    reg->capacidade = 1024;
+    reg->qtd = 0;
+    reg->nos = (NoTrie**)calloc(reg->capacidade, sizeof(NoTrie*));
+    reg->hashes = (uint64_t*)malloc(reg->capacidade * sizeof(uint64_t));
+    if (reg->nos == NULL || reg->hashes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    return reg;
+}
+
+// Dobra a tabela e reposiciona os nós (mantém ocupação abaixo de 50%)
+void crescerRegistro(RegistroDAWG* reg) {
+    size_t novaCapacidade = reg->capacidade * 2;
+    NoTrie** nos = (NoTrie**)calloc(novaCapacidade, sizeof(NoTrie*));
+    uint64_t* hashes = (uint64_t*)malloc(novaCapacidade * sizeof(uint64_t));
+    if (nos == NULL || hashes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < reg->capacidade; i++) {
+        if (reg->nos[i] == NULL) continue;
+        size_t pos = reg->hashes[i] & (novaCapacidade - 1);
+        while (nos[pos] != NULL) pos = (pos + 1) & (novaCapacidade - 1);
+        nos[pos] = reg->nos[i];
+        hashes[pos] = reg->hashes[i];
+    }
+    free(reg->nos);
+    free(reg->hashes);
+    reg->nos = nos;
+    reg->hashes = hashes;
+    reg->capacidade = novaCapacidade;
+}
+
+// Retorna o representante equivalente a 'no'; se não existe, 'no' passa a ser o representante
+NoTrie* registrarNo(RegistroDAWG* reg, NoTrie* no) {
+    uint64_t h = assinaturaNo(no);
+    size_t pos = h & (reg->capacidade - 1);
+    while (reg->nos[pos] != NULL) {
+        if (reg->hashes[pos] == h && nosEquivalentes(reg->nos[pos], no)) return reg->nos[pos];
+        pos = (pos + 1) & (reg->capacidade - 1);
+    }
+    reg->nos[pos] = no;
+    reg->hashes[pos] = h;
+    reg->qtd++;
+    if (reg->qtd * 2 > reg->capacidade) crescerRegistro(reg);
+    return no;
+}
+
+// Auxiliar recursivo: minimiza os filhos primeiro (pós-ordem) e depois o próprio nó.
+// Retorna o nó que deve ficar no lugar de 'no'.
+NoTrie* minimizarRecursivo(NoTrie* no, RegistroDAWG* reg) {
+    for (int i = 0; i < no->qtdFilhos; i++) {
+        no->filhos[i] = minimizarRecursivo(no->filhos[i], reg);
+    }
+    NoTrie* representante = registrarNo(reg, no);
+    if (representante != no) {
+        // Já existe uma subárvore igual: só este nó sai, seus filhos são compartilhados
+        free(no->filhos);
+        free(no);
+    }
+    return representante;
+}
+
+// Transforma a Trie em DAWG no próprio lugar (*raiz pode mudar).
+// Retorna o registro, que é dono de todos os nós e deve ser liberado com liberarDAWG.
+RegistroDAWG* minimizarTrie(NoTrie** raiz) {
+    RegistroDAWG* reg = criarRegistro();
+    *raiz = minimizarRecursivo(*raiz, reg);
+    return reg;
+}
+
+// Bytes ocupados pelo DAWG (cada nó é contado uma vez)
+long medirDAWG(RegistroDAWG* reg) {
+    long bytes = 0;
+    for (size_t i = 0; i < reg->capacidade; i++) {
+        if (reg->nos[i] != NULL) bytes += sizeof(NoTrie) + reg->nos[i]->qtdFilhos * sizeof(NoTrie*);
+    }
+    return bytes;
+}
+
+// Libera o DAWG: cada nó aparece uma única vez no registro
+void liberarDAWG(RegistroDAWG* reg) {
+    for (size_t i = 0; i < reg->capacidade; i++) {
+        if (reg->nos[i] != NULL) {
+            free(reg->nos[i]->filhos);
+            free(reg->nos[i]);
+        }
+    }
+    free(reg->nos);
+    free(reg->hashes);
+    free(reg);
+}
+
+// ============================================================================
+// DICIONÁRIO DE TESTE
+// ============================================================================
+
+// Lê uma palavra por linha do arquivo. Retorna a quantidade lida.
+// Linhas com TAM_PALAVRA caracteres ou mais são puladas inteiras (o fgets
+// as partiria em pedaços que virariam palavras falsas).
+int carregarPalavras(const char* caminho, char*** palavras) {
+    FILE* arquivo = fopen(caminho, "r");
+    if (arquivo == NULL) return 0;
+
+    int capacidade = 1024, qtd = 0, longas = 0;
+    char linha[TAM_PALAVRA + 2]; // Palavra + "\r\n"
+    *palavras = (char**)malloc(capacidade * sizeof(char*));
+
+    while (fgets(linha, sizeof(linha), arquivo)) {
+        if (strchr(linha, '\n') == NULL && !feof(arquivo)) {
+            int c;
+            while ((c = fgetc(arquivo)) != '\n' && c != EOF); // Descarta o resto da linha longa
+            longas++;
+            continue;
+        }
+        linha[strcspn(linha, "\r\n")] = '\0';
+        if (linha[0] == '\0') continue;
+        if (strlen(linha) >= TAM_PALAVRA) {
+            longas++;
+            continue;
+        }
+        if (qtd == capacidade) {
+            capacidade *= 2;
+            *palavras = (char**)realloc(*palavras, capacidade * sizeof(char*));
+        }
+        (*palavras)[qtd] = (char*)malloc(strlen(linha) + 1);
+        strcpy((*palavras)[qtd], linha);
+        qtd++;
+    }
+    fclose(arquivo);
+    if (longas > 0) printf("[AVISO] %d linha(s) com %d caracteres ou mais foram ignoradas.\n", longas, TAM_PALAVRA);
+    return qtd;
+}
+
+// Gera palavras juntando um radical e uma terminação comum do português,
+// o que cria muitos sufixos repetidos (como em um dicionário real)
+int gerarPalavras(int qtd, char*** palavras) {
+    const char* silabas[] = {
+        "ca", "sa", "ro", "mi", "nha", "de", "to", "pe", "li", "ra",
+        "bo", "ma", "te", "co", "la", "ve", "ne", "di", "so", "pa",
+        "men", "tra", "gu", "fi", "ar", "es", "in", "con", "por", "des"
+    };
+    const char* terminacoes[] = {
+        "", "s", "ção", "ções", "mente", "dor", "dora", "dores", "ando", "endo",
+        "ado", "ada", "ados", "adas", "ar", "er", "ir", "ava", "ível", "eza"
+    };
+    int qtdSilabas = sizeof(silabas) / sizeof(silabas[0]);
+    int qtdTerminacoes = sizeof(terminacoes) / sizeof(terminacoes[0]);
+
+    *palavras = (char**)malloc(qtd * sizeof(char*));
+    srand(42);
+    for (int i = 0; i < qtd; i++) {
+        char palavra[TAM_PALAVRA] = "";
+        int partes = 2 + rand() % 4;
+        for (int p = 0; p < partes; p++) strcat(palavra, silabas[rand() % qtdSilabas]);
+        strcat(palavra, terminacoes[rand() % qtdTerminacoes]);
+        (*palavras)[i] = (char*)malloc(strlen(palavra) + 1);
+        strcpy((*palavras)[i], palavra);
+    }
+    return qtd;
+}
+
+// ============================================================================
+// MAIN: TESTES E COMPARAÇÃO
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    printf("========================================================\n");
+    printf("       TRIE vs DAWG (SUFIXOS COMPARTILHADOS)\n");
+    printf("========================================================\n");
+
+    // ------------------------------------------------------------
+    // TESTE 1: Palavras pequenas com sufixos em comum
+    // ------------------------------------------------------------
+    char* exemplos[] = {"casa", "casas", "casar", "asa", "asas", "asar", "cantar", "andar"};
+    NoTrie* trieExemplo = criarNoTrie();
+    for (int i = 0; i < 8; i++) inserirTrie(trieExemplo, exemplos[i]);
+    long nosAntes = 0, bytesAntes = 0;
+    medirTrie(trieExemplo, &nosAntes, &bytesAntes);
+    RegistroDAWG* regExemplo = minimizarTrie(&trieExemplo);
+
+    printf("Palavras: casa, casas, casar, asa, asas, asar, cantar, andar\n");
+    printf("Trie: %ld nos | DAWG: %zu nos\n", nosAntes, regExemplo->qtd);
+    char* buscas[] = {"casar", "asa", "cas", "andar", "andas"};
+    for (int i = 0; i < 5; i++) {
+        printf("Busca '%s': %s\n", buscas[i],
+               buscarTrie(trieExemplo, buscas[i]) ? "ENCONTRADO" : "NAO ENCONTRADO");
+    }
+    liberarDAWG(regExemplo);
+
+    // ------------------------------------------------------------
+    // TESTE 2: Dicionário grande
+    // ------------------------------------------------------------
+    char** palavras = NULL;
+    int qtd = 0;
+    if (argc > 1) qtd = carregarPalavras(argv[1], &palavras);
+    if (qtd == 0) {
+        if (argc > 1) printf("\nNão foi possível ler '%s'. Usando dicionário sintético.\n", argv[1]);
+        qtd = gerarPalavras(300000, &palavras);
+    }
+    printf("\n--- Dicionário com %d palavras ---\n", qtd);
+
+    char** ausentes = (char**)malloc(qtd * sizeof(char*));
+    for (int i = 0; i < qtd; i++) {
+        ausentes[i] = (char*)malloc(strlen(palavras[i]) + 2);
+        sprintf(ausentes[i], "%sq", palavras[i]);
+    }
+
+    NoTrie* trie = criarNoTrie();
+    for (int i = 0; i < qtd; i++) inserirTrie(trie, palavras[i]);
+    long nosTrie = 0, bytesTrie = 0;
+    medirTrie(trie, &nosTrie, &bytesTrie);
+
+    long acertosTrie = 0, acertosDAWG = 0;
+    clock_t inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosTrie += buscarTrie(trie, palavras[i]);
+    for (int i = 0; i < qtd; i++) acertosTrie += buscarTrie(trie, ausentes[i]);
+    clock_t fim = clock();
+    double buscaTrie = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    RegistroDAWG* reg = minimizarTrie(&trie);
+    fim = clock();
+    double tempoMinimizacao = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    // Mesma função de busca, agora percorrendo o DAWG
+    inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosDAWG += buscarTrie(trie, palavras[i]);
+    for (int i = 0; i < qtd; i++) acertosDAWG += buscarTrie(trie, ausentes[i]);
+    fim = clock();
+    double buscaDAWG = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    long bytesDAWG = medirDAWG(reg);
+    printf("Minimizacao: %f segundos\n", tempoMinimizacao);
+    printf("%-22s %15s %15s\n", "", "Trie", "DAWG");
+    printf("%-22s %15ld %15zu\n", "Nos", nosTrie, reg->qtd);
+    printf("%-22s %15.1f %15.1f\n", "Memoria (MB)", bytesTrie / (1024.0 * 1024.0), bytesDAWG / (1024.0 * 1024.0));
+    printf("%-22s %15.1f %15.1f\n", "ns por busca",
+           buscaTrie * 1e9 / (2.0 * qtd), buscaDAWG * 1e9 / (2.0 * qtd));
+    printf("Reducao de memoria: %.1f%%\n", 100.0 * (1.0 - (double)bytesDAWG / bytesTrie));
+    printf("Resultados %s (%ld encontradas)\n",
+           acertosTrie == acertosDAWG ? "CONFEREM" : "DIVERGEM (ERRO!)", acertosDAWG);
+
+    liberarDAWG(reg);
+    for (int i = 0; i < qtd; i++) {
+        free(palavras[i]);
+        free(ausentes[i]);
+    }
+    free(palavras);
+    free(ausentes);
+
+    printf("\nMemoria liberada. Fim do programa.\n");
+    return 0;
+}
@@ -0,0 +1,527 @@
+/*
+ * Objetivo: "Congelar" a Trie de ponteiros do BST_TRIE.c em uma Double-Array
+ *           Trie (vetores BASE e CHECK) para consultas rápidas e compactas.
+ *
+ * Ideia: o dicionário é montado uma única vez com a Trie comum (NoTrie) e
+ * consultado muitas vezes. Depois de montado, convertemos cada nó em um
+ * estado (um índice inteiro) e cada transição em duas leituras de vetor:
+ *
+ *     t = BASE[s] + código(letra)      -> estado de destino
+ *     CHECK[t] == s                    -> confirma que a transição existe
+ *
+ * Códigos: 0 = fim de palavra, 1..26 = letras a..z.
+ *
+ * Como só existem inteiros (nenhum ponteiro), o resultado pode ser gravado
+ * em arquivo e carregado com mmap: os vetores são usados direto do arquivo,
+ * sem reconstruir nada.
+ *
+ * Uso: ./Trie_Double_Array [arquivo_de_palavras.txt] [saida.bin]
+ *      Sem saida.bin, o arquivo temporário dicionario_da.bin é apagado no fim.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+
+#ifdef _WIN32
+// No Windows (MSYS2/ucrt) não há mmap: o arquivo é lido inteiro para a memória.
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define TAM_ALFABETO 26 // Considerando apenas letras minúsculas a-z
+#define TAM_PALAVRA 100 // Tamanho máximo de palavra considerado
+
+// ============================================================================
+// ESTRUTURA 1: TRIE DE PONTEIROS (igual ao BST_TRIE.c) - usada na montagem
+// ============================================================================
+
+typedef struct NoTrie {
+    struct NoTrie* filhos[TAM_ALFABETO]; // Vetor de ponteiros para as próximas letras
+    bool fimDaPalavra;                   // Marca se este nó encerra uma palavra válida
+} NoTrie;
+
+long qtdNosTrie = 0; // Contador de nós para estimar memória
+
+NoTrie* criarNoTrie() {
+    NoTrie* novo = (NoTrie*)malloc(sizeof(NoTrie));
+    if (novo) {
+        novo->fimDaPalavra = false;
+        for (int i = 0; i < TAM_ALFABETO; i++) {
+            novo->filhos[i] = NULL;
+        }
+        qtdNosTrie++;
+    }
+    return novo;
+}
+
+int charParaIndice(char c) {
+    return tolower((unsigned char)c) - 'a';
+}
+
+void inserirTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+        if (indice < 0 || indice >= TAM_ALFABETO) continue;
+        if (atual->filhos[indice] == NULL) {
+            atual->filhos[indice] = criarNoTrie();
+        }
+        atual = atual->filhos[indice];
+    }
+    atual->fimDaPalavra = true;
+}
+
+bool buscarTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+        if (indice < 0 || indice >= TAM_ALFABETO) return false;
+        if (atual->filhos[indice] == NULL) return false;
+        atual = atual->filhos[indice];
+    }
+    return (atual != NULL && atual->fimDaPalavra);
+}
+
+void liberarTrie(NoTrie* raiz) {
+    if (raiz == NULL) return;
+    for (int i = 0; i < TAM_ALFABETO; i++) {
+        liberarTrie(raiz->filhos[i]);
+    }
+    free(raiz);
+}
+
+// ============================================================================
+// ESTRUTURA 2: DOUBLE-ARRAY TRIE (somente leitura)
+// ============================================================================
+
+#define ESTADO_RAIZ 1     // Índice 0 nunca é usado como estado
+#define CELULA_LIVRE 0    // CHECK == 0 marca célula livre durante a montagem
+#define CHECK_RAIZ -1     // A raiz não tem pai, mas sua célula está ocupada
+
+// Cabeçalho do arquivo serializado (seguido por BASE[tamanho] e CHECK[tamanho])
+typedef struct {
+    char magica[8];       // "TRIEDA1\0"
+    uint32_t tamanho;     // Quantidade de células em cada vetor
+    uint32_t qtdPalavras;
+} CabecalhoDA;
+
+typedef struct {
+    int32_t* base;
+    int32_t* check;
+    uint32_t tamanho;
+    uint32_t qtdPalavras;
+    // Origem da memória, para liberar corretamente
+    void* mapeamento;     // Região do arquivo (mmap) ou buffer lido
+    size_t bytesMapeados;
+    bool doArquivo;
+} TrieDA;
+
+// Auxiliar: garante que os vetores tenham pelo menos 'minimo' células (zeradas)
+static void garantirTamanho(TrieDA* da, uint32_t minimo) {
+    if (minimo <= da->tamanho) return;
+    uint32_t novo = da->tamanho ? da->tamanho : 1024;
+    while (novo < minimo) novo *= 2;
+
+    da->base = (int32_t*)realloc(da->base, novo * sizeof(int32_t));
+    da->check = (int32_t*)realloc(da->check, novo * sizeof(int32_t));
+    if (da->base == NULL || da->check == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    memset(da->base + da->tamanho, 0, (novo - da->tamanho) * sizeof(int32_t));
+    memset(da->check + da->tamanho, 0, (novo - da->tamanho) * sizeof(int32_t));
+    da->tamanho = novo;
+}
+
+/*
+ * congelarTrie() – converte a Trie de ponteiros em Double-Array.
+ * Percorre a Trie em largura. Para cada nó, procura o menor BASE em que
+ * todas as células BASE + código (dos filhos e do fim de palavra) estão livres.
+ * A busca começa na primeira célula livre conhecida, o que mantém os
+ * vetores densos.
+ */
+TrieDA* congelarTrie(NoTrie* raiz) {
+    TrieDA* da = (TrieDA*)calloc(1, sizeof(TrieDA));
+    if (da == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    garantirTamanho(da, 1024);
+    da->check[ESTADO_RAIZ] = CHECK_RAIZ;
+
+    // Fila de (nó da Trie, estado correspondente)
+    long capacidade = qtdNosTrie + 1;
+    NoTrie** filaNo = (NoTrie**)malloc(capacidade * sizeof(NoTrie*));
+    int32_t* filaEstado = (int32_t*)malloc(capacidade * sizeof(int32_t));
+    if (filaNo == NULL || filaEstado == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    long frente = 0, fim = 0;
+    filaNo[fim] = raiz;
+    filaEstado[fim++] = ESTADO_RAIZ;
+
+    uint32_t primeiroLivre = ESTADO_RAIZ + 1;
+    uint32_t ultimoUsado = ESTADO_RAIZ;
+
+    while (frente < fim) {
+        NoTrie* no = filaNo[frente];
+        int32_t s = filaEstado[frente++];
+
+        // Códigos que este estado precisa (0 = fim de palavra, 1..26 = letras)
+        int codigos[TAM_ALFABETO + 1], qtd = 0;
+        if (no->fimDaPalavra) codigos[qtd++] = 0;
+        for (int i = 0; i < TAM_ALFABETO; i++) {
+            if (no->filhos[i]) codigos[qtd++] = i + 1;
+        }
+        if (qtd == 0) continue;
+
+        // Avança o marcador de primeira célula livre
+        while (primeiroLivre < da->tamanho && da->check[primeiroLivre] != CELULA_LIVRE) primeiroLivre++;
+
+        // Procura um BASE em que todas as células necessárias estão livres
+        int32_t b = (int32_t)primeiroLivre - codigos[0];
+        if (b < 1) b = 1;
+        while (1) {
+            garantirTamanho(da, (uint32_t)b + TAM_ALFABETO + 1);
+            bool cabe = true;
+            for (int k = 0; k < qtd; k++) {
+                if (da->check[b + codigos[k]] != CELULA_LIVRE) { cabe = false; break; }
+            }
+            if (cabe) break;
+            b++;
+        }
+
+        // Ocupa as células e enfileira os filhos
+        da->base[s] = b;
+        for (int k = 0; k < qtd; k++) {
+            int32_t t = b + codigos[k];
+            da->check[t] = s;
+            if ((uint32_t)t > ultimoUsado) ultimoUsado = (uint32_t)t;
+            if (codigos[k] == 0) {
+                da->qtdPalavras++;
+            } else {
+                filaNo[fim] = no->filhos[codigos[k] - 1];
+                filaEstado[fim++] = t;
+            }
+        }
+    }
+    free(filaNo);
+    free(filaEstado);
+
+    // Corta as células que sobraram no fim dos vetores
+    da->tamanho = ultimoUsado + TAM_ALFABETO + 1;
+    da->base = (int32_t*)realloc(da->base, da->tamanho * sizeof(int32_t));
+    da->check = (int32_t*)realloc(da->check, da->tamanho * sizeof(int32_t));
+    return da;
+}
+
+/*
+ * buscarDA() – busca exata com a mesma semântica de buscarTrie():
+ * duas leituras de vetor e uma comparação por letra.
+ */
+bool buscarDA(const TrieDA* da, const char* palavra) {
+    const int32_t* base = da->base;
+    const int32_t* check = da->check;
+    uint32_t tamanho = da->tamanho;
+    int32_t s = ESTADO_RAIZ;
+
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+        if (indice < 0 || indice >= TAM_ALFABETO) return false;
+
+        uint32_t t = (uint32_t)(base[s] + indice + 1);
+        if (t >= tamanho || check[t] != s) return false;
+        s = (int32_t)t;
+    }
+    // Transição de código 0 indica fim de palavra
+    uint32_t t = (uint32_t)base[s];
+    return t != 0 && t < tamanho && check[t] == s;
+}
+
+/*
+ * salvarDA() – grava cabeçalho + BASE + CHECK. Retorna true em caso de sucesso.
+ * O formato usa a ordem de bytes da máquina (o arquivo é um cache local).
+ */
+bool salvarDA(const TrieDA* da, const char* caminho) {
+    FILE* arquivo = fopen(caminho, "wb");
+    if (arquivo == NULL) return false;
+
+    CabecalhoDA cab;
+    memset(&cab, 0, sizeof(cab));
+    memcpy(cab.magica, "TRIEDA1", 8);
+    cab.tamanho = da->tamanho;
+    cab.qtdPalavras = da->qtdPalavras;
+
+    bool ok = fwrite(&cab, sizeof(cab), 1, arquivo) == 1 &&
+              fwrite(da->base, sizeof(int32_t), da->tamanho, arquivo) == da->tamanho &&
+              fwrite(da->check, sizeof(int32_t), da->tamanho, arquivo) == da->tamanho;
+    fclose(arquivo);
+    return ok;
+}
+
+/*
+ * carregarDA() – mapeia o arquivo e aponta BASE/CHECK direto para ele.
+ * Não há reconstrução: o custo de abrir é o mesmo para qualquer tamanho.
+ * Retorna NULL se o arquivo não existir ou não for válido.
+ */
+TrieDA* carregarDA(const char* caminho) {
+    void* dados = NULL;
+    size_t bytes = 0;
+
+#ifdef _WIN32
+    FILE* arquivo = fopen(caminho, "rb");
+    if (arquivo == NULL) return NULL;
+    fseek(arquivo, 0, SEEK_END);
+    bytes = (size_t)ftell(arquivo);
+    fseek(arquivo, 0, SEEK_SET);
+    dados = malloc(bytes);
+    if (dados == NULL || fread(dados, 1, bytes, arquivo) != bytes) {
+        free(dados);
+        fclose(arquivo);
+        return NULL;
+    }
+    fclose(arquivo);
+#else
+    int fd = open(caminho, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return NULL;
+    }
+    bytes = (size_t)info.st_size;
+    dados = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // O mapeamento continua válido após fechar o descritor
+    if (dados == MAP_FAILED) return NULL;
+#endif
+
+    CabecalhoDA* cab = (CabecalhoDA*)dados;
+    bool valido = bytes >= sizeof(CabecalhoDA) && memcmp(cab->magica, "TRIEDA1", 8) == 0 &&
+                  bytes == sizeof(CabecalhoDA) + 2 * (size_t)cab->tamanho * sizeof(int32_t);
+
+    TrieDA* da = valido ? (TrieDA*)calloc(1, sizeof(TrieDA)) : NULL;
+    if (da == NULL) {
+#ifdef _WIN32
+        free(dados);
+#else
+        munmap(dados, bytes);
+#endif
+        return NULL;
+    }
+
+    da->tamanho = cab->tamanho;
+    da->qtdPalavras = cab->qtdPalavras;
+    da->base = (int32_t*)((char*)dados + sizeof(CabecalhoDA));
+    da->check = da->base + da->tamanho;
+    da->mapeamento = dados;
+    da->bytesMapeados = bytes;
+    da->doArquivo = true;
+    return da;
+}
+
+// Libera a Double-Array (vetores próprios ou mapeamento do arquivo)
+void liberarDA(TrieDA* da) {
+    if (da == NULL) return;
+    if (da->doArquivo) {
+#ifdef _WIN32
+        free(da->mapeamento);
+#else
+        munmap(da->mapeamento, da->bytesMapeados);
+#endif
+    } else {
+        free(da->base);
+        free(da->check);
+    }
+    free(da);
+}
+
+// ============================================================================
+// DICIONÁRIO DE TESTE
+// ============================================================================
+
+// Lê uma palavra por linha do arquivo. Retorna a quantidade lida.
+// Linhas com TAM_PALAVRA caracteres ou mais são puladas inteiras (o fgets
+// as partiria em pedaços que virariam palavras falsas).
+int carregarPalavras(const char* caminho, char*** palavras) {
+    FILE* arquivo = fopen(caminho, "r");
+    if (arquivo == NULL) return 0;
+
+    int capacidade = 1024, qtd = 0, longas = 0;
+    char linha[TAM_PALAVRA + 2]; // Palavra + "\r\n"
+    *palavras = (char**)malloc(capacidade * sizeof(char*));
+
+    while (fgets(linha, sizeof(linha), arquivo)) {
+        if (strchr(linha, '\n') == NULL && !feof(arquivo)) {
+            int c;
+            while ((c = fgetc(arquivo)) != '\n' && c != EOF); // Descarta o resto da linha longa
+            longas++;
+            continue;
+        }
+        linha[strcspn(linha, "\r\n")] = '\0';
+        if (linha[0] == '\0') continue;
+        if (strlen(linha) >= TAM_PALAVRA) {
+            longas++;
+            continue;
+        }
+        if (qtd == capacidade) {
+            capacidade *= 2;
+            *palavras = (char**)realloc(*palavras, capacidade * sizeof(char*));
+        }
+        (*palavras)[qtd] = (char*)malloc(strlen(linha) + 1);
+        strcpy((*palavras)[qtd], linha);
+        qtd++;
+    }
+    fclose(arquivo);
+    if (longas > 0) printf("[AVISO] %d linha(s) com %d caracteres ou mais foram ignoradas.\n", longas, TAM_PALAVRA);
+    return qtd;
+}
+
+// Gera palavras juntando sílabas, o que cria prefixos e sufixos compartilhados
+int gerarPalavras(int qtd, char*** palavras) {
+    const char* silabas[] = {
+        "ca", "sa", "ro", "mi", "nha", "de", "to", "pe", "li", "ra",
+        "bo", "ma", "te", "co", "la", "ve", "ne", "di", "so", "pa",
+        "men", "tra", "gu", "fi", "ção", "ar", "es", "in", "con", "por"
+    };
+    int qtdSilabas = sizeof(silabas) / sizeof(silabas[0]);
+
+    *palavras = (char**)malloc(qtd * sizeof(char*));
+    srand(42);
+    for (int i = 0; i < qtd; i++) {
+        char palavra[TAM_PALAVRA] = "";
+        int partes = 2 + rand() % 5;
+        for (int p = 0; p < partes; p++) strcat(palavra, silabas[rand() % qtdSilabas]);
+        (*palavras)[i] = (char*)malloc(strlen(palavra) + 1);
+        strcpy((*palavras)[i], palavra);
+    }
+    return qtd;
+}
+
+// ============================================================================
+// MAIN: TESTES E COMPARAÇÃO
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    const char* arquivoSaida = (argc > 2) ? argv[2] : "dicionario_da.bin";
+    bool saidaTemporaria = (argc <= 2);
+
+    printf("========================================================\n");
+    printf("       TRIE DE PONTEIROS vs DOUBLE-ARRAY TRIE\n");
+    printf("========================================================\n");
+
+    // ------------------------------------------------------------
+    // TESTE 1: Mesmas palavras do BST_TRIE.c
+    // ------------------------------------------------------------
+    char* exemplos[] = {"casa", "carro", "caminhao", "arvore", "dado", "bola"};
+    NoTrie* trieExemplo = criarNoTrie();
+    for (int i = 0; i < 6; i++) inserirTrie(trieExemplo, exemplos[i]);
+    TrieDA* daExemplo = congelarTrie(trieExemplo);
+    liberarTrie(trieExemplo);
+
+    printf("Double-Array com %u células para %u palavras\n", daExemplo->tamanho, daExemplo->qtdPalavras);
+    char* buscas[] = {"carro", "caminh", "caminhao", "bolas", "dado"};
+    for (int i = 0; i < 5; i++) {
+        printf("Busca '%s': %s\n", buscas[i],
+               buscarDA(daExemplo, buscas[i]) ? "ENCONTRADO" : "NAO ENCONTRADO");
+    }
+    liberarDA(daExemplo);
+
+    // ------------------------------------------------------------
+    // TESTE 2: Dicionário grande
+    // ------------------------------------------------------------
+    char** palavras = NULL;
+    int qtd = 0;
+    if (argc > 1) qtd = carregarPalavras(argv[1], &palavras);
+    if (qtd == 0) {
+        if (argc > 1) printf("\nNão foi possível ler '%s'. Usando dicionário sintético.\n", argv[1]);
+        qtdNosTrie = 0;
+        qtd = gerarPalavras(300000, &palavras);
+    }
+    printf("\n--- Dicionário com %d palavras ---\n", qtd);
+
+    char** ausentes = (char**)malloc(qtd * sizeof(char*));
+    for (int i = 0; i < qtd; i++) {
+        ausentes[i] = (char*)malloc(strlen(palavras[i]) + 2);
+        sprintf(ausentes[i], "%sq", palavras[i]);
+    }
+
+    qtdNosTrie = 0;
+    NoTrie* trie = criarNoTrie();
+    for (int i = 0; i < qtd; i++) inserirTrie(trie, palavras[i]);
+
+    clock_t inicio = clock();
+    TrieDA* da = congelarTrie(trie);
+    clock_t fim = clock();
+    printf("Congelamento: %f segundos\n", ((double)(fim - inicio)) / CLOCKS_PER_SEC);
+
+    long acertosTrie = 0, acertosDA = 0, acertosArquivo = 0;
+
+    inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosTrie += buscarTrie(trie, palavras[i]);
+    for (int i = 0; i < qtd; i++) acertosTrie += buscarTrie(trie, ausentes[i]);
+    fim = clock();
+    double buscaTrie = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosDA += buscarDA(da, palavras[i]);
+    for (int i = 0; i < qtd; i++) acertosDA += buscarDA(da, ausentes[i]);
+    fim = clock();
+    double buscaDA = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    // Serialização e carga sem reconstrução
+    if (!salvarDA(da, arquivoSaida)) {
+        printf("[ERRO] Não foi possível gravar '%s'.\n", arquivoSaida);
+    }
+    inicio = clock();
+    TrieDA* daArquivo = carregarDA(arquivoSaida);
+    fim = clock();
+    double tempoCarga = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    if (daArquivo != NULL) {
+        for (int i = 0; i < qtd; i++) acertosArquivo += buscarDA(daArquivo, palavras[i]);
+        for (int i = 0; i < qtd; i++) acertosArquivo += buscarDA(daArquivo, ausentes[i]);
+    }
+
+    double mbTrie = qtdNosTrie * (double)sizeof(NoTrie) / (1024.0 * 1024.0);
+    double mbDA = 2.0 * da->tamanho * sizeof(int32_t) / (1024.0 * 1024.0);
+
+    printf("%-22s %15s %15s\n", "", "Trie", "Double-Array");
+    printf("%-22s %15ld %15u\n", "Nos / celulas", qtdNosTrie, da->tamanho);
+    printf("%-22s %15.1f %15.1f\n", "Memoria (MB)", mbTrie, mbDA);
+    printf("%-22s %15.3f %15.3f\n", "Buscas (s)", buscaTrie, buscaDA);
+    printf("%-22s %15.1f %15.1f\n", "ns por busca",
+           buscaTrie * 1e9 / (2.0 * qtd), buscaDA * 1e9 / (2.0 * qtd));
+    printf("Ocupação dos vetores: %.1f%%\n", 100.0 * (qtdNosTrie + da->qtdPalavras) / da->tamanho);
+
+    if (daArquivo != NULL) {
+        printf("Arquivo '%s' carregado em %f segundos (sem reconstrução)\n", arquivoSaida, tempoCarga);
+    } else {
+        printf("[ERRO] Não foi possível carregar '%s'.\n", arquivoSaida);
+    }
+    printf("Resultados %s (%ld encontradas)\n",
+           (acertosTrie == acertosDA && acertosDA == acertosArquivo) ? "CONFEREM" : "DIVERGEM (ERRO!)",
+           acertosDA);
+
+    liberarDA(daArquivo); // Desmapeia antes de apagar (exigido no Windows)
+    liberarDA(da);
+    liberarTrie(trie);
+    if (saidaTemporaria) remove(arquivoSaida);
+    for (int i = 0; i < qtd; i++) {
+        free(palavras[i]);
+        free(ausentes[i]);
+    }
+    free(palavras);
+    free(ausentes);
+
+    printf("\nMemoria liberada. Fim do programa.\n");
+    return 0;
+}
@@ -0,0 +1,491 @@
+/*
+ * Objetivo: Trie compactada (Radix Tree / Patricia) comparada com a Trie de
+ *           26 ponteiros do BST_TRIE.c.
+ *
+ * Problema: cada NoTrie carrega filhos[26] (mais de 200 bytes por nó), e quase
+ * todos os ponteiros ficam NULL. Em uma cadeia como "c-a-m-i-n-h-a-o" cada
+ * letra vira um nó inteiro.
+ *
+ * Solução: na Radix Tree, cadeias de nós com um único filho viram um único
+ * nó cuja aresta carrega um rótulo com várias letras ("minhao"). Cada nó só
+ * guarda os filhos que realmente existem.
+ *
+ * A semântica de inserção/busca é a mesma da Trie original: letras são
+ * convertidas para minúsculas, outros caracteres são ignorados na inserção
+ * e fazem a busca falhar.
+ *
+ * Uso: ./Trie_Radix [arquivo_de_palavras.txt]
+ *      Sem arquivo, um dicionário sintético é gerado.
+ *      Linhas do arquivo com TAM_PALAVRA caracteres ou mais são ignoradas,
+ *      então as duas estruturas recebem exatamente as mesmas palavras.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+
+#define TAM_ALFABETO 26 // Considerando apenas letras minúsculas a-z
+#define TAM_PALAVRA 100 // Linhas do arquivo e chaves normalizadas na pilha (maiores usam malloc)
+
+// ============================================================================
+// ESTRUTURA 1: TRIE ORIGINAL (26 ponteiros por nó) - referência
+// ============================================================================
+
+typedef struct NoTrie {
+    struct NoTrie* filhos[TAM_ALFABETO]; // Vetor de ponteiros para as próximas letras
+    bool fimDaPalavra;                   // Marca se este nó encerra uma palavra válida
+} NoTrie;
+
+long qtdNosTrie = 0; // Contador de nós para estimar memória
+
+NoTrie* criarNoTrie() {
+    NoTrie* novo = (NoTrie*)malloc(sizeof(NoTrie));
+    if (novo) {
+        novo->fimDaPalavra = false;
+        for (int i = 0; i < TAM_ALFABETO; i++) {
+            novo->filhos[i] = NULL;
+        }
+        qtdNosTrie++;
+    }
+    return novo;
+}
+
+int charParaIndice(char c) {
+    return tolower((unsigned char)c) - 'a';
+}
+
+void inserirTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+        if (indice < 0 || indice >= TAM_ALFABETO) continue;
+        if (atual->filhos[indice] == NULL) {
+            atual->filhos[indice] = criarNoTrie();
+        }
+        atual = atual->filhos[indice];
+    }
+    atual->fimDaPalavra = true;
+}
+
+bool buscarTrie(NoTrie* raiz, char* palavra) {
+    NoTrie* atual = raiz;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+        if (indice < 0 || indice >= TAM_ALFABETO) return false;
+        if (atual->filhos[indice] == NULL) return false;
+        atual = atual->filhos[indice];
+    }
+    return (atual != NULL && atual->fimDaPalavra);
+}
+
+void liberarTrie(NoTrie* raiz) {
+    if (raiz == NULL) return;
+    for (int i = 0; i < TAM_ALFABETO; i++) {
+        liberarTrie(raiz->filhos[i]);
+    }
+    free(raiz);
+}
+
+// ============================================================================
+// ESTRUTURA 2: RADIX TREE (TRIE COMPACTADA)
+// Lógica: cada aresta carrega um rótulo com uma ou mais letras. Um nó só
+// existe onde o caminho se divide ou onde uma palavra termina.
+// ============================================================================
+
+typedef struct NoRadix {
+    struct NoRadix** filhos;    // Bloco único: qtdFilhos ponteiros seguidos de qtdFilhos letras
+    unsigned char qtdFilhos;    // Quantos filhos existem (no máximo 26)
+    bool fimDaPalavra;          // Marca se este nó encerra uma palavra válida
+    int32_t tamRotulo;          // Tamanho do rótulo da aresta que chega neste nó (sizeof continua 16)
+    char rotulo[];              // Letras da aresta (sem '\0')
+} NoRadix;
+
+// Primeira letra do rótulo de cada filho, guardada logo após os ponteiros.
+// Assim a escolha do filho lê um único bloco, sem visitar cada filho.
+#define LETRAS_FILHOS(no) ((char*)((no)->filhos + (no)->qtdFilhos))
+
+// Cria um nó com o rótulo indicado
+NoRadix* criarNoRadix(const char* rotulo, int tamRotulo) {
+    NoRadix* novo = (NoRadix*)malloc(sizeof(NoRadix) + tamRotulo);
+    if (novo) {
+        novo->filhos = NULL;
+        novo->qtdFilhos = 0;
+        novo->fimDaPalavra = false;
+        novo->tamRotulo = tamRotulo;
+        memcpy(novo->rotulo, rotulo, tamRotulo);
+    }
+    return novo;
+}
+
+// Auxiliar: normaliza a palavra como a Trie original (minúsculas a-z).
+// Na inserção, caracteres inválidos são ignorados; na busca, invalidam a palavra.
+// 'chave' precisa de strlen(palavra) + 1 bytes (ver bufferChave).
+// Retorna o tamanho da chave normalizada ou -1 se a busca deve falhar.
+int normalizarPalavra(const char* palavra, char* chave, bool ehBusca) {
+    int tam = 0;
+    for (int i = 0; palavra[i] != '\0'; i++) {
+        int indice = charParaIndice(palavra[i]);
+        if (indice < 0 || indice >= TAM_ALFABETO) {
+            if (ehBusca) return -1;
+            continue;
+        }
+        chave[tam++] = (char)('a' + indice);
+    }
+    chave[tam] = '\0';
+    return tam;
+}
+
+// Auxiliar: buffer para a chave normalizada. Palavras comuns usam 'local'
+// (TAM_PALAVRA bytes, na pilha); maiores recebem um bloco do tamanho delas,
+// então nenhuma chave é cortada (a Trie original também não tem limite).
+char* bufferChave(const char* palavra, char* local) {
+    size_t tam = strlen(palavra);
+    if (tam < TAM_PALAVRA) return local;
+    char* chave = (char*)malloc(tam + 1);
+    if (chave == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    return chave;
+}
+
+// Auxiliar: posição do filho que começa com a letra c (ou -1)
+int posicaoFilho(NoRadix* no, char c) {
+    char* letras = LETRAS_FILHOS(no);
+    for (int i = 0; i < no->qtdFilhos; i++) {
+        if (letras[i] == c) return i;
+    }
+    return -1;
+}
+
+// Auxiliar: adiciona um filho mantendo a ordem alfabética das letras
+void adicionarFilhoRadix(NoRadix* pai, NoRadix* filho) {
+    int qtd = pai->qtdFilhos;
+    char letra = filho->rotulo[0];
+    NoRadix** bloco = (NoRadix**)malloc((qtd + 1) * (sizeof(NoRadix*) + 1));
+    if (bloco == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    char* letrasNovas = (char*)(bloco + qtd + 1);
+    char* letrasAntigas = qtd > 0 ? LETRAS_FILHOS(pai) : NULL;
+
+    int j = 0;
+    for (int i = 0; i < qtd; i++) {
+        if (j == i && letrasAntigas[i] > letra) {
+            bloco[j] = filho;
+            letrasNovas[j++] = letra;
+        }
+        bloco[j] = pai->filhos[i];
+        letrasNovas[j++] = letrasAntigas[i];
+    }
+    if (j == qtd) {
+        bloco[j] = filho;
+        letrasNovas[j] = letra;
+    }
+
+    free(pai->filhos);
+    pai->filhos = bloco;
+    pai->qtdFilhos = (unsigned char)(qtd + 1);
+}
+
+// Auxiliar: insere uma chave já normalizada
+void inserirChaveRadix(NoRadix* raiz, const char* chave, int tam) {
+    NoRadix* atual = raiz;
+    int pos = 0;
+
+    while (pos < tam) {
+        int i = posicaoFilho(atual, chave[pos]);
+
+        // Nenhuma aresta começa com esta letra: o restante vira uma folha
+        if (i < 0) {
+            NoRadix* folha = criarNoRadix(chave + pos, tam - pos);
+            folha->fimDaPalavra = true;
+            adicionarFilhoRadix(atual, folha);
+            return;
+        }
+
+        NoRadix* filho = atual->filhos[i];
+        int comum = 0;
+        while (comum < filho->tamRotulo && pos + comum < tam &&
+               filho->rotulo[comum] == chave[pos + comum]) {
+            comum++;
+        }
+
+        // O rótulo inteiro bate: desce para o filho
+        if (comum == filho->tamRotulo) {
+            atual = filho;
+            pos += comum;
+            continue;
+        }
+
+        // Divergência no meio do rótulo: divide a aresta em duas.
+        // "caminhao" + "carro" -> "ca" com filhos "minhao" e "rro"
+        NoRadix* meio = criarNoRadix(filho->rotulo, comum);
+        memmove(filho->rotulo, filho->rotulo + comum, filho->tamRotulo - comum);
+        filho->tamRotulo -= comum;
+        adicionarFilhoRadix(meio, filho);
+        atual->filhos[i] = meio; // A letra inicial é a mesma, a ordem não muda
+
+        atual = meio;
+        pos += comum;
+    }
+    // Marca o nó alcançado como fim de uma palavra completa
+    atual->fimDaPalavra = true;
+}
+
+// Insere uma palavra na Radix Tree
+void inserirRadix(NoRadix* raiz, char* palavra) {
+    char local[TAM_PALAVRA];
+    char* chave = bufferChave(palavra, local);
+    int tam = normalizarPalavra(palavra, chave, false);
+    inserirChaveRadix(raiz, chave, tam);
+    if (chave != local) free(chave);
+}
+
+// Auxiliar: busca exata de uma chave já normalizada
+bool buscarChaveRadix(NoRadix* raiz, const char* chave, int tam) {
+    NoRadix* atual = raiz;
+    int pos = 0;
+    while (pos < tam) {
+        int i = posicaoFilho(atual, chave[pos]);
+        if (i < 0) return false;
+
+        NoRadix* filho = atual->filhos[i];
+        // A palavra precisa conter o rótulo inteiro (termina no meio = não existe)
+        if (tam - pos < filho->tamRotulo) return false;
+        if (memcmp(filho->rotulo, chave + pos, filho->tamRotulo) != 0) return false;
+
+        pos += filho->tamRotulo;
+        atual = filho;
+    }
+    return atual->fimDaPalavra;
+}
+
+// Busca uma palavra exata na Radix Tree
+bool buscarRadix(NoRadix* raiz, char* palavra) {
+    char local[TAM_PALAVRA];
+    char* chave = bufferChave(palavra, local);
+    int tam = normalizarPalavra(palavra, chave, true);
+    bool achou = (tam >= 0) && buscarChaveRadix(raiz, chave, tam);
+    if (chave != local) free(chave);
+    return achou;
+}
+
+// Conta nós e bytes ocupados pela Radix Tree
+void medirRadix(NoRadix* no, long* qtdNos, long* bytes) {
+    if (no == NULL) return;
+    (*qtdNos)++;
+    *bytes += sizeof(NoRadix) + no->tamRotulo + no->qtdFilhos * (sizeof(NoRadix*) + 1);
+    for (int i = 0; i < no->qtdFilhos; i++) {
+        medirRadix(no->filhos[i], qtdNos, bytes);
+    }
+}
+
+// Imprime a estrutura da Radix Tree (apenas para dicionários pequenos)
+void exibirRadix(NoRadix* no, int nivel) {
+    for (int i = 0; i < no->qtdFilhos; i++) {
+        NoRadix* filho = no->filhos[i];
+        printf("%*s+-- %.*s%s\n", nivel * 4, "", filho->tamRotulo, filho->rotulo,
+               filho->fimDaPalavra ? " (*)" : "");
+        exibirRadix(filho, nivel + 1);
+    }
+}
+
+// Libera memória da Radix Tree (Recursivo)
+void liberarRadix(NoRadix* raiz) {
+    if (raiz == NULL) return;
+    for (int i = 0; i < raiz->qtdFilhos; i++) {
+        liberarRadix(raiz->filhos[i]);
+    }
+    free(raiz->filhos);
+    free(raiz);
+}
+
+// ============================================================================
+// DICIONÁRIO DE TESTE
+// ============================================================================
+
+// Lê uma palavra por linha do arquivo. Retorna a quantidade lida.
+// Linhas com TAM_PALAVRA caracteres ou mais são puladas inteiras (o fgets
+// as partiria em pedaços que virariam palavras falsas).
+int carregarPalavras(const char* caminho, char*** palavras) {
+    FILE* arquivo = fopen(caminho, "r");
+    if (arquivo == NULL) return 0;
+
+    int capacidade = 1024, qtd = 0, longas = 0;
+    char linha[TAM_PALAVRA + 2]; // Palavra + "\r\n"
+    *palavras = (char**)malloc(capacidade * sizeof(char*));
+
+    while (fgets(linha, sizeof(linha), arquivo)) {
+        if (strchr(linha, '\n') == NULL && !feof(arquivo)) {
+            int c;
+            while ((c = fgetc(arquivo)) != '\n' && c != EOF);
+            longas++;
+            continue;
+        }
+        linha[strcspn(linha, "\r\n")] = '\0';
+        if (linha[0] == '\0') continue;
+        if (strlen(linha) >= TAM_PALAVRA) {
+            longas++;
+            continue;
+        }
+        if (qtd == capacidade) {
+            capacidade *= 2;
+            *palavras = (char**)realloc(*palavras, capacidade * sizeof(char*));
+        }
+        (*palavras)[qtd] = (char*)malloc(strlen(linha) + 1);
+        strcpy((*palavras)[qtd], linha);
+        qtd++;
+    }
+    fclose(arquivo);
+    if (longas > 0) printf("[AVISO] %d linha(s) com %d caracteres ou mais foram ignoradas.\n", longas, TAM_PALAVRA);
+    return qtd;
+}
+
+// Gera palavras juntando sílabas, o que cria prefixos e sufixos compartilhados
+int gerarPalavras(int qtd, char*** palavras) {
+    const char* silabas[] = {
+        "ca", "sa", "ro", "mi", "nha", "de", "to", "pe", "li", "ra",
+        "bo", "ma", "te", "co", "la", "ve", "ne", "di", "so", "pa",
+        "men", "tra", "gu", "fi", "ção", "ar", "es", "in", "con", "por"
+    };
+    int qtdSilabas = sizeof(silabas) / sizeof(silabas[0]);
+
+    *palavras = (char**)malloc(qtd * sizeof(char*));
+    srand(42);
+    for (int i = 0; i < qtd; i++) {
+        char palavra[TAM_PALAVRA] = "";
+        int partes = 2 + rand() % 5;
+        for (int p = 0; p < partes; p++) strcat(palavra, silabas[rand() % qtdSilabas]);
+        (*palavras)[i] = (char*)malloc(strlen(palavra) + 1);
+        strcpy((*palavras)[i], palavra);
+    }
+    return qtd;
+}
+
+// ============================================================================
+// MAIN: TESTES E COMPARAÇÃO
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    printf("========================================================\n");
+    printf("       TRIE (26 ponteiros) vs RADIX TREE (compactada)\n");
+    printf("========================================================\n");
+
+    // ------------------------------------------------------------
+    // TESTE 1: Mesmas palavras do BST_TRIE.c
+    // ------------------------------------------------------------
+    char* exemplos[] = {"casa", "carro", "caminhao", "arvore", "dado", "bola"};
+    NoRadix* radixExemplo = criarNoRadix("", 0);
+    for (int i = 0; i < 6; i++) inserirRadix(radixExemplo, exemplos[i]);
+
+    printf("Estrutura da Radix Tree:\n(Raiz)\n");
+    exibirRadix(radixExemplo, 0);
+
+    char* buscas[] = {"carro", "caminh", "ca", "casa", "arvores"};
+    for (int i = 0; i < 5; i++) {
+        printf("Busca '%s': %s\n", buscas[i],
+               buscarRadix(radixExemplo, buscas[i]) ? "ENCONTRADO" : "NAO ENCONTRADO");
+    }
+    liberarRadix(radixExemplo);
+
+    // ------------------------------------------------------------
+    // TESTE 2: Dicionário grande - memória e velocidade
+    // ------------------------------------------------------------
+    char** palavras = NULL;
+    int qtd = 0;
+    if (argc > 1) qtd = carregarPalavras(argv[1], &palavras);
+    if (qtd == 0) {
+        if (argc > 1) printf("\nNão foi possível ler '%s'. Usando dicionário sintético.\n", argv[1]);
+        qtd = gerarPalavras(300000, &palavras);
+    }
+    printf("\n--- Dicionário com %d palavras ---\n", qtd);
+
+    // Palavras ausentes: cada palavra com uma letra extra no fim
+    char** ausentes = (char**)malloc(qtd * sizeof(char*));
+    for (int i = 0; i < qtd; i++) {
+        ausentes[i] = (char*)malloc(strlen(palavras[i]) + 2);
+        sprintf(ausentes[i], "%sq", palavras[i]);
+    }
+
+    clock_t inicio, fim;
+
+    inicio = clock();
+    NoTrie* trie = criarNoTrie();
+    for (int i = 0; i < qtd; i++) inserirTrie(trie, palavras[i]);
+    fim = clock();
+    double montarTrie = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    NoRadix* radix = criarNoRadix("", 0);
+    for (int i = 0; i < qtd; i++) inserirRadix(radix, palavras[i]);
+    fim = clock();
+    double montarRadix = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    // Buscas (acertos e erros) - contamos os acertos para conferir as duas estruturas
+    long acertosTrie = 0, acertosRadix = 0;
+
+    inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosTrie += buscarTrie(trie, palavras[i]);
+    for (int i = 0; i < qtd; i++) acertosTrie += buscarTrie(trie, ausentes[i]);
+    fim = clock();
+    double buscaTrie = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    for (int i = 0; i < qtd; i++) acertosRadix += buscarRadix(radix, palavras[i]);
+    for (int i = 0; i < qtd; i++) acertosRadix += buscarRadix(radix, ausentes[i]);
+    fim = clock();
+    double buscaRadix = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    long nosRadix = 0, bytesRadix = 0;
+    medirRadix(radix, &nosRadix, &bytesRadix);
+    long bytesTrie = qtdNosTrie * (long)sizeof(NoTrie);
+
+    printf("%-22s %15s %15s\n", "", "Trie", "Radix Tree");
+    printf("%-22s %15ld %15ld\n", "Nos", qtdNosTrie, nosRadix);
+    printf("%-22s %15.1f %15.1f\n", "Memoria (MB)", bytesTrie / (1024.0 * 1024.0), bytesRadix / (1024.0 * 1024.0));
+    printf("%-22s %15.3f %15.3f\n", "Construcao (s)", montarTrie, montarRadix);
+    printf("%-22s %15.3f %15.3f\n", "Buscas (s)", buscaTrie, buscaRadix);
+    printf("%-22s %15.1f %15.1f\n", "ns por busca",
+           buscaTrie * 1e9 / (2.0 * qtd), buscaRadix * 1e9 / (2.0 * qtd));
+    printf("Resultados das buscas %s (%ld encontradas)\n",
+           acertosTrie == acertosRadix ? "CONFEREM" : "DIVERGEM (ERRO!)", acertosRadix);
+    printf("(Memória medida sem o cabeçalho interno do malloc.)\n");
+
+    liberarTrie(trie);
+    liberarRadix(radix);
+    for (int i = 0; i < qtd; i++) {
+        free(palavras[i]);
+        free(ausentes[i]);
+    }
+    free(palavras);
+    free(ausentes);
+
+    printf("\nMemoria liberada. Fim do programa.\n");
+    return 0;
+}
+
+/*
+ Radix Tree para casa, carro, caminhao, arvore, dado, bola:
+
+(Raiz)
+  |
+  +--- arvore (*)
+  |
+  +--- bola (*)
+  |
+  +--- ca --+-- minhao (*)
+  |         |
+  |         +-- rro (*)
+  |         |
+  |         +-- sa (*)
+  |
+  +--- dado (*)
+
+ Compare com a Trie do BST_TRIE.c: 28 nós contra 8 aqui.
+*/
@@ -0,0 +1,424 @@
+/*
+ * Jogo: Detective Quest
+ * Tema: Dicas de Navegação com Ancestral Comum Mais Próximo (LCA)
+ *
+ * Descrição:
+ * O sistema de dicas precisa responder duas perguntas sobre o mapa:
+ *   1. Qual é a sala mais próxima que é "caminho comum" entre a posição
+ *      do jogador e a sala da pista? (Ancestral Comum Mais Próximo - LCA)
+ *   2. Quantos movimentos separam as duas salas? (Distância na árvore)
+ *
+ * Em vez de subir a árvore sala por sala a cada pergunta, fazemos um
+ * pré-processamento único:
+ *   - Percurso de Euler: visita a árvore anotando cada sala sempre que
+ *     passamos por ela (2n - 1 registros) junto com sua profundidade.
+ *   - Sparse Table: tabela de mínimos por intervalos de tamanho 2^k sobre
+ *     o percurso de Euler. O LCA de duas salas é a sala de menor
+ *     profundidade entre as suas primeiras ocorrências no percurso.
+ *
+ * Custo: O(n log n) para montar, O(1) por consulta.
+ *
+ * Conceitos: Árvores Binárias, Percurso de Euler, Programação Dinâmica.
+ *
+ * Autor: Augusto Bento Carvalho
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Definição da estrutura da Sala (Nó da Árvore)
+typedef struct Sala {
+    char nome[50];          // Nome do cômodo
+    int id;                 // Índice da sala no pré-processamento (0 a n-1)
+    struct Sala* esquerda;  // Caminho à esquerda
+    struct Sala* direita;   // Caminho à direita
+} Sala;
+
+// Estrutura com o resultado do pré-processamento do mapa
+typedef struct {
+    int qtdSalas;           // Número de salas (n)
+    Sala** salas;           // salas[id] -> ponteiro para a sala
+    int* pai;               // pai[id] -> id da sala anterior (-1 na raiz)
+    int* profundidade;      // profundidade[id] -> movimentos desde a raiz
+    int* primeiraVisita;    // primeiraVisita[id] -> posição no percurso de Euler
+    int* euler;             // Percurso de Euler (ids), tamanho 2n - 1
+    int tamEuler;
+    int* log2;              // log2[i] = piso(log2(i)), para i de 1 a tamEuler
+    int** tabela;           // tabela[k][i] -> id de menor profundidade em euler[i .. i + 2^k - 1]
+    int niveis;
+} MapaLCA;
+
+// --- Protótipos das Funções ---
+
+// Cria, de forma dinâmica, uma sala com nome.
+Sala* criarSala(char* nome);
+
+// Pré-processa o mapa (Percurso de Euler + Sparse Table).
+MapaLCA* prepararLCA(Sala* raiz);
+
+// Retorna a sala ancestral comum mais próxima entre a e b.
+Sala* ancestralComum(MapaLCA* mapa, Sala* a, Sala* b);
+
+// Retorna o número de movimentos entre a e b.
+int distanciaSalas(MapaLCA* mapa, Sala* a, Sala* b);
+
+// Versão ingênua (sobe pelos pais), usada para conferência.
+int ancestralComumIngenuo(MapaLCA* mapa, int a, int b);
+
+// Funções auxiliares para liberar a memória ao final.
+void liberarLCA(MapaLCA* mapa);
+void liberarMapa(Sala* raiz);
+
+// Testes
+void demonstrarDicas(Sala* mapa);
+void testarMapaGrande(int qtdSalas, int qtdConsultas);
+
+// --- Função Principal ---
+
+int main() {
+    // Mesmo mapa do Detective Quest
+    Sala* mapa = criarSala("Hall de Entrada");
+
+    mapa->esquerda = criarSala("Sala de Estar");
+    mapa->direita = criarSala("Cozinha");
+
+    mapa->esquerda->esquerda = criarSala("Biblioteca");
+    mapa->esquerda->direita = criarSala("Jardim de Inverno");
+
+    mapa->direita->esquerda = criarSala("Sala de Jantar");
+    mapa->direita->direita = criarSala("Porão Escuro");
+
+    printf("=========================================\n");
+    printf("   DETECTIVE QUEST: SISTEMA DE DICAS     \n");
+    printf("=========================================\n");
+
+    demonstrarDicas(mapa);
+    liberarMapa(mapa);
+
+    // Conferência e medição em uma mansão gerada aleatoriamente
+    testarMapaGrande(200000, 1000000);
+
+    printf("\nMemória liberada. Fim do programa.\n");
+    return 0;
+}
+
+// --- Implementação das Funções ---
+
+/*
+ * Função: criarSala
+ * Objetivo: Aloca memória para uma nova sala e define seu nome.
+ */
+Sala* criarSala(char* nome) {
+    Sala* novaSala = (Sala*) malloc(sizeof(Sala));
+    if (novaSala == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    strcpy(novaSala->nome, nome);
+    novaSala->id = -1;
+    novaSala->esquerda = NULL;
+    novaSala->direita = NULL;
+    return novaSala;
+}
+
+// Auxiliar: malloc que encerra o programa em caso de falha
+static void* alocar(size_t bytes) {
+    void* p = malloc(bytes);
+    if (p == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    return p;
+}
+
+// Auxiliar: conta as salas da árvore (usa pilha explícita, sem recursão)
+static int contarSalas(Sala* raiz) {
+    if (raiz == NULL) return 0;
+    int capacidade = 64, topo = 0, total = 0;
+    Sala** pilha = (Sala**) alocar(capacidade * sizeof(Sala*));
+    pilha[topo++] = raiz;
+    while (topo > 0) {
+        Sala* atual = pilha[--topo];
+        total++;
+        if (topo + 2 > capacidade) {
+            capacidade *= 2;
+            pilha = (Sala**) realloc(pilha, capacidade * sizeof(Sala*));
+            if (pilha == NULL) {
+                printf("Erro crítico: Falha na alocação de memória.\n");
+                exit(1);
+            }
+        }
+        if (atual->direita) pilha[topo++] = atual->direita;
+        if (atual->esquerda) pilha[topo++] = atual->esquerda;
+    }
+    free(pilha);
+    return total;
+}
+
+/*
+ * Função: prepararLCA
+ * Objetivo: Numera as salas, monta o percurso de Euler e a Sparse Table.
+ *           O percurso é feito com pilha explícita para suportar mansões
+ *           muito profundas sem estourar a pilha de chamadas.
+ * Retorno: Estrutura com as tabelas prontas para consulta.
+ */
+MapaLCA* prepararLCA(Sala* raiz) {
+    MapaLCA* mapa = (MapaLCA*) alocar(sizeof(MapaLCA));
+    int n = contarSalas(raiz);
+
+    mapa->qtdSalas = n;
+    mapa->salas = (Sala**) alocar(n * sizeof(Sala*));
+    mapa->pai = (int*) alocar(n * sizeof(int));
+    mapa->profundidade = (int*) alocar(n * sizeof(int));
+    mapa->primeiraVisita = (int*) alocar(n * sizeof(int));
+    mapa->tamEuler = (n > 0) ? 2 * n - 1 : 0;
+    mapa->euler = (int*) alocar((mapa->tamEuler + 1) * sizeof(int));
+
+    // 1. Percurso de Euler com pilha de (sala, próximo filho a visitar)
+    Sala** pilhaSala = (Sala**) alocar((n + 1) * sizeof(Sala*));
+    int* pilhaEtapa = (int*) alocar((n + 1) * sizeof(int));
+    int topo = 0, proximoId = 0, pos = 0;
+
+    if (raiz != NULL) {
+        raiz->id = proximoId++;
+        mapa->salas[raiz->id] = raiz;
+        mapa->pai[raiz->id] = -1;
+        mapa->profundidade[raiz->id] = 0;
+        mapa->primeiraVisita[raiz->id] = pos;
+        mapa->euler[pos++] = raiz->id;
+        pilhaSala[topo] = raiz;
+        pilhaEtapa[topo] = 0;
+        topo++;
+    }
+
+    while (topo > 0) {
+        Sala* atual = pilhaSala[topo - 1];
+        int etapa = pilhaEtapa[topo - 1]++;
+        Sala* filho = NULL;
+
+        if (etapa == 0) filho = atual->esquerda;
+        else if (etapa == 1) filho = atual->direita;
+        else {
+            // Terminou os filhos: volta para o pai e registra a passagem
+            topo--;
+            if (topo > 0) mapa->euler[pos++] = pilhaSala[topo - 1]->id;
+            continue;
+        }
+
+        if (filho != NULL) {
+            filho->id = proximoId++;
+            mapa->salas[filho->id] = filho;
+            mapa->pai[filho->id] = atual->id;
+            mapa->profundidade[filho->id] = mapa->profundidade[atual->id] + 1;
+            mapa->primeiraVisita[filho->id] = pos;
+            mapa->euler[pos++] = filho->id;
+            pilhaSala[topo] = filho;
+            pilhaEtapa[topo] = 0;
+            topo++;
+        }
+    }
+    free(pilhaSala);
+    free(pilhaEtapa);
+
+    // 2. Tabela de logaritmos para escolher o nível da consulta em O(1)
+    int m = mapa->tamEuler;
+    mapa->log2 = (int*) alocar((m + 1) * sizeof(int));
+    mapa->log2[0] = 0;
+    if (m >= 1) mapa->log2[1] = 0;
+    for (int i = 2; i <= m; i++) mapa->log2[i] = mapa->log2[i / 2] + 1;
+
+    // 3. Sparse Table: nível k guarda o mínimo de blocos de tamanho 2^k
+    mapa->niveis = (m > 0) ? mapa->log2[m] + 1 : 0;
+    mapa->tabela = (int**) alocar((mapa->niveis + 1) * sizeof(int*));
+    if (mapa->niveis > 0) {
+        mapa->tabela[0] = (int*) alocar(m * sizeof(int));
+        memcpy(mapa->tabela[0], mapa->euler, m * sizeof(int));
+    }
+    for (int k = 1; k < mapa->niveis; k++) {
+        int tamanho = m - (1 << k) + 1;
+        int meio = 1 << (k - 1);
+        int* anterior = mapa->tabela[k - 1];
+        int* nivel = (int*) alocar(tamanho * sizeof(int));
+        for (int i = 0; i < tamanho; i++) {
+            int a = anterior[i], b = anterior[i + meio];
+            nivel[i] = (mapa->profundidade[a] <= mapa->profundidade[b]) ? a : b;
+        }
+        mapa->tabela[k] = nivel;
+    }
+
+    return mapa;
+}
+
+// Auxiliar: LCA por ids, consultando a Sparse Table em O(1)
+static int ancestralComumId(MapaLCA* mapa, int a, int b) {
+    int l = mapa->primeiraVisita[a];
+    int r = mapa->primeiraVisita[b];
+    if (l > r) { int t = l; l = r; r = t; }
+
+    // Dois blocos de tamanho 2^k que cobrem [l, r] (podem se sobrepor)
+    int k = mapa->log2[r - l + 1];
+    int x = mapa->tabela[k][l];
+    int y = mapa->tabela[k][r - (1 << k) + 1];
+    return (mapa->profundidade[x] <= mapa->profundidade[y]) ? x : y;
+}
+
+/*
+ * Função: ancestralComum
+ * Objetivo: Retorna a sala mais próxima que está no caminho da raiz até
+ *           a e também no caminho da raiz até b.
+ */
+Sala* ancestralComum(MapaLCA* mapa, Sala* a, Sala* b) {
+    if (a == NULL || b == NULL) return NULL;
+    return mapa->salas[ancestralComumId(mapa, a->id, b->id)];
+}
+
+/*
+ * Função: distanciaSalas
+ * Objetivo: Quantidade de movimentos entre duas salas:
+ *           prof(a) + prof(b) - 2 * prof(LCA).
+ */
+int distanciaSalas(MapaLCA* mapa, Sala* a, Sala* b) {
+    if (a == NULL || b == NULL) return -1;
+    int c = ancestralComumId(mapa, a->id, b->id);
+    return mapa->profundidade[a->id] + mapa->profundidade[b->id] - 2 * mapa->profundidade[c];
+}
+
+/*
+ * Função: ancestralComumIngenuo
+ * Objetivo: Sobe a sala mais profunda até igualar os níveis e depois sobe
+ *           as duas juntas. Custo O(altura) por consulta.
+ */
+int ancestralComumIngenuo(MapaLCA* mapa, int a, int b) {
+    while (mapa->profundidade[a] > mapa->profundidade[b]) a = mapa->pai[a];
+    while (mapa->profundidade[b] > mapa->profundidade[a]) b = mapa->pai[b];
+    while (a != b) {
+        a = mapa->pai[a];
+        b = mapa->pai[b];
+    }
+    return a;
+}
+
+/*
+ * Função: demonstrarDicas
+ * Objetivo: Mostra algumas dicas no mapa do jogo.
+ */
+void demonstrarDicas(Sala* mapa) {
+    MapaLCA* lca = prepararLCA(mapa);
+
+    Sala* jogador[] = { mapa->esquerda->esquerda, mapa->esquerda->esquerda, mapa->direita->direita, mapa };
+    Sala* pista[]   = { mapa->esquerda->direita,  mapa->direita->esquerda,  mapa->direita,          mapa->esquerda->direita };
+    int qtd = 4;
+
+    for (int i = 0; i < qtd; i++) {
+        Sala* comum = ancestralComum(lca, jogador[i], pista[i]);
+        printf("\nJogador em: %s | Pista em: %s\n", jogador[i]->nome, pista[i]->nome);
+        printf(" -> Volte até: %s\n", comum->nome);
+        printf(" -> Movimentos necessários: %d\n", distanciaSalas(lca, jogador[i], pista[i]));
+    }
+
+    liberarLCA(lca);
+}
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+static int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+/*
+ * Função: testarMapaGrande
+ * Objetivo: Gera uma mansão aleatória, confere o LCA rápido contra a versão
+ *           ingênua e compara o tempo das duas.
+ */
+void testarMapaGrande(int qtdSalas, int qtdConsultas) {
+    printf("\n=========================================\n");
+    printf("   TESTE: MANSÃO COM %d SALAS\n", qtdSalas);
+    printf("=========================================\n");
+
+    srand(42);
+    Sala** todas = (Sala**) alocar(qtdSalas * sizeof(Sala*));
+    todas[0] = criarSala("Sala 0");
+    for (int i = 1; i < qtdSalas; i++) {
+        char nome[50];
+        sprintf(nome, "Sala %d", i);
+        todas[i] = criarSala(nome);
+
+        // Pendura a nova sala em uma sala aleatória que ainda tem porta livre
+        while (1) {
+            Sala* pai = todas[aleatorio() % i];
+            if (pai->esquerda == NULL) { pai->esquerda = todas[i]; break; }
+            if (pai->direita == NULL) { pai->direita = todas[i]; break; }
+        }
+    }
+
+    clock_t inicio = clock();
+    MapaLCA* lca = prepararLCA(todas[0]);
+    clock_t fim = clock();
+    printf("Pré-processamento: %f segundos\n", ((double)(fim - inicio)) / CLOCKS_PER_SEC);
+
+    int* consultaA = (int*) alocar(qtdConsultas * sizeof(int));
+    int* consultaB = (int*) alocar(qtdConsultas * sizeof(int));
+    for (int i = 0; i < qtdConsultas; i++) {
+        consultaA[i] = aleatorio() % qtdSalas;
+        consultaB[i] = aleatorio() % qtdSalas;
+    }
+
+    long somaRapida = 0, somaIngenua = 0;
+
+    inicio = clock();
+    for (int i = 0; i < qtdConsultas; i++)
+        somaRapida += distanciaSalas(lca, todas[consultaA[i]], todas[consultaB[i]]);
+    fim = clock();
+    double tempoRapido = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    for (int i = 0; i < qtdConsultas; i++) {
+        int a = todas[consultaA[i]]->id, b = todas[consultaB[i]]->id;
+        int c = ancestralComumIngenuo(lca, a, b);
+        somaIngenua += lca->profundidade[a] + lca->profundidade[b] - 2 * lca->profundidade[c];
+    }
+    fim = clock();
+    double tempoIngenuo = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+
+    printf("Consultas: %d\n", qtdConsultas);
+    printf("Sparse Table: %f segundos\n", tempoRapido);
+    printf("Subindo pelos pais: %f segundos\n", tempoIngenuo);
+    printf("Resultados %s\n", (somaRapida == somaIngenua) ? "CONFEREM" : "DIVERGEM (ERRO!)");
+
+    free(consultaA);
+    free(consultaB);
+    liberarLCA(lca);
+    // As salas foram alocadas individualmente; o vetor permite liberar sem recursão
+    for (int i = 0; i < qtdSalas; i++) free(todas[i]);
+    free(todas);
+}
+
+/*
+ * Função: liberarLCA
+ * Objetivo: Libera as tabelas do pré-processamento (não libera as salas).
+ */
+void liberarLCA(MapaLCA* mapa) {
+    if (mapa == NULL) return;
+    for (int k = 0; k < mapa->niveis; k++) free(mapa->tabela[k]);
+    free(mapa->tabela);
+    free(mapa->log2);
+    free(mapa->euler);
+    free(mapa->primeiraVisita);
+    free(mapa->profundidade);
+    free(mapa->pai);
+    free(mapa->salas);
+    free(mapa);
+}
+
+/*
+ * Função: liberarMapa
+ * Objetivo: Percorre a árvore recursivamente liberando a memória alocada (Pós-ordem).
+ */
+void liberarMapa(Sala* raiz) {
+    if (raiz != NULL) {
+        liberarMapa(raiz->esquerda);
+        liberarMapa(raiz->direita);
+        free(raiz);
+    }
+}
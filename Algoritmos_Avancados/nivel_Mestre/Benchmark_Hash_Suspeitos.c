@@ -0,0 +1,290 @@
+/*
+ * Objetivo: Comparar a tabela hash de suspeitos antiga do
+ *           Detective_Quest_Mestre.c (soma dos caracteres % 31, tamanho fixo)
+ *           com a atual (FNV-1a de 64 bits, dobra quando a carga passa de 0.75),
+ *           de 10 até 10 milhões de pistas.
+ *
+ * Para cada tamanho: maior lista encadeada, comparações médias por busca
+ * bem-sucedida e tempo médio de busca.
+ * A tabela antiga para em 1 milhão de pistas: com 31 baldes, cada busca
+ * percorre dezenas de milhares de nós.
+ *
+ * Uso: ./Benchmark_Hash_Suspeitos [max_pistas]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define LIMITE_ANTIGA 1000000 // Maior tamanho medido na tabela antiga
+#define TAM_CHAVE 40
+
+// Nó do Detective_Quest_Mestre.c sem o idSuspeito (o benchmark não usa o placar)
+typedef struct HashNode {
+    char pista[100];
+    char suspeito[50];
+    uint64_t hash;            // Hash completo da pista (não é recalculado ao crescer)
+    struct HashNode* proximo; // Tratamento de colisão por encadeamento
+} HashNode;
+
+// ============================================================================
+// TABELA ANTIGA (soma dos caracteres, 31 baldes)
+// ============================================================================
+
+#define TAM_HASH 31
+
+int funcaoHashAntiga(char* chave) {
+    int soma = 0;
+    for (int i = 0; chave[i] != '\0'; i++) {
+        soma += chave[i];
+    }
+    return soma % TAM_HASH;
+}
+
+void inserirAntiga(HashNode* tabela[], char* pista, char* suspeito) {
+    int indice = funcaoHashAntiga(pista);
+    HashNode* novo = (HashNode*)malloc(sizeof(HashNode));
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    strcpy(novo->pista, pista);
+    strcpy(novo->suspeito, suspeito);
+    novo->proximo = tabela[indice];
+    tabela[indice] = novo;
+}
+
+char* encontrarAntigo(HashNode* tabela[], char* pista) {
+    HashNode* atual = tabela[funcaoHashAntiga(pista)];
+    while (atual != NULL) {
+        if (strcmp(atual->pista, pista) == 0) return atual->suspeito;
+        atual = atual->proximo;
+    }
+    return NULL;
+}
+
+// ============================================================================
+// TABELA ATUAL (igual ao Detective_Quest_Mestre.c)
+// ============================================================================
+
+typedef struct {
+    HashNode** baldes;
+    int capacidade;           // Sempre potência de 2 (índice = hash & (capacidade - 1))
+    int qtd;
+} TabelaHash;
+
+#define CAPACIDADE_INICIAL_HASH 32
+#define CARGA_MAXIMA_HASH 0.75 // Acima disso a tabela dobra de tamanho
+
+uint64_t funcaoHash(const char* chave) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const unsigned char* c = (const unsigned char*)chave; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+int indiceHash(TabelaHash* tabela, uint64_t hash) {
+    return (int)((hash ^ (hash >> 32)) & (uint64_t)(tabela->capacidade - 1));
+}
+
+void iniciarHash(TabelaHash* tabela) {
+    tabela->capacidade = CAPACIDADE_INICIAL_HASH;
+    tabela->qtd = 0;
+    tabela->baldes = (HashNode**)calloc(tabela->capacidade, sizeof(HashNode*));
+    if (tabela->baldes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+}
+
+void crescerHash(TabelaHash* tabela) {
+    HashNode** antigos = tabela->baldes;
+    int capacidadeAntiga = tabela->capacidade;
+    tabela->capacidade *= 2;
+    tabela->baldes = (HashNode**)calloc(tabela->capacidade, sizeof(HashNode*));
+    if (tabela->baldes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (int i = 0; i < capacidadeAntiga; i++) {
+        HashNode* atual = antigos[i];
+        while (atual != NULL) {
+            HashNode* proximo = atual->proximo;
+            int indice = indiceHash(tabela, atual->hash);
+            atual->proximo = tabela->baldes[indice];
+            tabela->baldes[indice] = atual;
+            atual = proximo;
+        }
+    }
+    free(antigos);
+}
+
+void inserirNaHash(TabelaHash* tabela, char* pista, char* suspeito) {
+    uint64_t hash = funcaoHash(pista);
+    int indice = indiceHash(tabela, hash);
+    for (HashNode* atual = tabela->baldes[indice]; atual != NULL; atual = atual->proximo) {
+        if (atual->hash == hash && strcmp(atual->pista, pista) == 0) {
+            strcpy(atual->suspeito, suspeito);
+            return;
+        }
+    }
+
+    if (tabela->qtd + 1 > CARGA_MAXIMA_HASH * tabela->capacidade) {
+        crescerHash(tabela);
+        indice = indiceHash(tabela, hash);
+    }
+    HashNode* novo = (HashNode*)malloc(sizeof(HashNode));
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    strcpy(novo->pista, pista);
+    strcpy(novo->suspeito, suspeito);
+    novo->hash = hash;
+    novo->proximo = tabela->baldes[indice];
+    tabela->baldes[indice] = novo;
+    tabela->qtd++;
+}
+
+char* encontrarSuspeito(TabelaHash* tabela, char* pista) {
+    uint64_t hash = funcaoHash(pista);
+    HashNode* atual = tabela->baldes[indiceHash(tabela, hash)];
+    while (atual != NULL) {
+        if (atual->hash == hash && strcmp(atual->pista, pista) == 0) return atual->suspeito;
+        atual = atual->proximo;
+    }
+    return NULL;
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+// Auxiliar: estatísticas das listas. Uma busca bem-sucedida pelo k-ésimo nó
+// de uma lista faz k comparações, então uma lista de tamanho L soma L(L+1)/2.
+void estatisticasListas(HashNode** baldes, int qtdBaldes, long qtd, long* maior, double* comparacoes) {
+    *maior = 0;
+    double soma = 0;
+    for (int i = 0; i < qtdBaldes; i++) {
+        long tam = 0;
+        for (HashNode* n = baldes[i]; n != NULL; n = n->proximo) tam++;
+        if (tam > *maior) *maior = tam;
+        soma += tam * (tam + 1) / 2.0;
+    }
+    *comparacoes = soma / qtd;
+}
+
+void liberarBaldes(HashNode** baldes, int qtdBaldes) {
+    for (int i = 0; i < qtdBaldes; i++) {
+        HashNode* atual = baldes[i];
+        while (atual != NULL) {
+            HashNode* temp = atual;
+            atual = atual->proximo;
+            free(temp);
+        }
+    }
+}
+
+/*
+ * Função: medir
+ * Insere 'qtd' pistas em cada tabela e mede buscas de pistas existentes.
+ * O número de buscas diminui com o custo esperado, para cada linha levar
+ * mais ou menos o mesmo tempo.
+ */
+void medir(char (*chaves)[TAM_CHAVE], long qtd) {
+    const char* suspeitos[] = {"Jardineiro", "Mordomo", "Governanta"};
+    long qtdBuscas = 2000000;
+    long* sorteio = (long*)malloc(qtdBuscas * sizeof(long));
+    if (sorteio == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (long i = 0; i < qtdBuscas; i++) sorteio[i] = aleatorio() % qtd;
+    long encontrados = 0;
+
+    // Tabela antiga
+    char maiorAntiga[24] = "-", compAntiga[24] = "-", nsAntiga[24] = "-";
+    if (qtd <= LIMITE_ANTIGA) {
+        HashNode* tabela[TAM_HASH] = {NULL};
+        for (long i = 0; i < qtd; i++) inserirAntiga(tabela, chaves[i], (char*)suspeitos[i % 3]);
+        long maior;
+        double comparacoes;
+        estatisticasListas(tabela, TAM_HASH, qtd, &maior, &comparacoes);
+
+        long buscas = qtdBuscas;
+        if (comparacoes > 50) buscas = (long)(qtdBuscas * 50 / comparacoes) + 100;
+        clock_t inicio = clock();
+        for (long i = 0; i < buscas; i++) encontrados += encontrarAntigo(tabela, chaves[sorteio[i]]) != NULL;
+        double tempo = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+
+        sprintf(maiorAntiga, "%ld", maior);
+        sprintf(compAntiga, "%.1f", comparacoes);
+        sprintf(nsAntiga, "%.0f", tempo * 1e9 / buscas);
+        liberarBaldes(tabela, TAM_HASH);
+    }
+
+    // Tabela atual
+    TabelaHash tabela;
+    iniciarHash(&tabela);
+    clock_t inicio = clock();
+    for (long i = 0; i < qtd; i++) inserirNaHash(&tabela, chaves[i], (char*)suspeitos[i % 3]);
+    double tempoInsercao = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+    long maior;
+    double comparacoes;
+    estatisticasListas(tabela.baldes, tabela.capacidade, qtd, &maior, &comparacoes);
+
+    inicio = clock();
+    for (long i = 0; i < qtdBuscas; i++) encontrados += encontrarSuspeito(&tabela, chaves[sorteio[i]]) != NULL;
+    double tempo = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+
+    printf("%10ld | %8s %8s %10s | %6ld %6.2f %8.0f %10d %8.0f\n", qtd, maiorAntiga, compAntiga, nsAntiga,
+           maior, comparacoes, tempo * 1e9 / qtdBuscas, tabela.capacidade, tempoInsercao * 1e9 / qtd);
+    if (encontrados == 0) printf("[ERRO] Nenhuma pista encontrada.\n");
+
+    liberarBaldes(tabela.baldes, tabela.capacidade);
+    free(tabela.baldes);
+    free(sorteio);
+}
+
+int main(int argc, char* argv[]) {
+    long maximo = 10000000;
+    if (argc > 1 && atol(argv[1]) >= 10) maximo = atol(argv[1]);
+
+    printf("==========================================================================\n");
+    printf("   TABELA HASH DE SUSPEITOS: SOMA %% 31 (FIXA) vs FNV-1a (CRESCE)\n");
+    printf("==========================================================================\n");
+
+    // Pistas no estilo do jogo. Os números trocados de posição ("registro 123"
+    // e "registro 321") têm a mesma soma de caracteres.
+    const char* objetos[] = {"Pegadas de lama", "Relogio parado", "Livro de venenos", "Taca quebrada",
+                             "Chave enferrujada", "Carta rasgada", "Luva manchada", "Vela apagada"};
+    char (*chaves)[TAM_CHAVE] = (char (*)[TAM_CHAVE])malloc(maximo * TAM_CHAVE);
+    if (chaves == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (long i = 0; i < maximo; i++) sprintf(chaves[i], "%s, registro %ld", objetos[i % 8], i);
+    srand(42);
+
+    printf("%10s | %-28s | %-44s\n", "", "Antiga (31 baldes)", "FNV-1a + crescimento");
+    printf("%10s | %8s %8s %10s | %6s %6s %8s %10s %8s\n", "Pistas", "Maior", "Comp.", "ns/busca",
+           "Maior", "Comp.", "ns/busca", "Baldes", "ns/ins.");
+    for (long qtd = 10; qtd <= maximo; qtd *= 10) {
+        medir(chaves, qtd);
+        fflush(stdout);
+    }
+    printf("\nMaior = maior lista encadeada | Comp. = comparacoes por busca bem-sucedida\n");
+
+    free(chaves);
+    printf("\nFim do programa.\n");
+    return 0;
+}
@@ -0,0 +1,480 @@
+/*
+ * Autor: Augusto Bento Carvalho
+ *
+ * Jogo: Detective Quest: Mansão em Grafo
+ *
+ * Objetivo: Representar mansões reais, onde um cômodo pode ter qualquer
+ *           número de portas e os corredores podem formar ciclos.
+ * Estruturas:
+ *   1. Grafo em CSR (Compressed Sparse Row): as portas de todas as salas
+ *      ficam em um único vetor contíguo. A sala v usa o trecho
+ *      destino[inicio[v] .. inicio[v + 1] - 1].
+ *   2. Fila em vetor: BFS para menor número de movimentos.
+ *   3. Heap binário: Dijkstra para menor custo (portas com pesos).
+ *
+ * Por que CSR? Cada sala tem apenas um índice de início; as vizinhas são
+ * lidas em sequência na memória, sem um nó alocado por porta. Isso
+ * mantém BFS/Dijkstra rápidos mesmo com milhões de portas.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+// ============================================================================
+// DEFINIÇÃO DAS ESTRUTURAS
+// ============================================================================
+
+// Porta (aresta) usada apenas durante a construção do grafo
+typedef struct {
+    int origem;
+    int destino;
+    int custo;              // Tempo para atravessar (usado pelo Dijkstra)
+} Porta;
+
+// Grafo da mansão em formato CSR
+typedef struct {
+    int qtdSalas;           // Número de vértices
+    int qtdArestas;         // Número de arestas dirigidas armazenadas
+    int* inicio;            // inicio[v] .. inicio[v + 1] - 1: portas da sala v
+    int* destino;           // Sala do outro lado da porta
+    int* custo;             // Custo da porta
+    char (*nomes)[50];      // Nome de cada sala (opcional, NULL nos testes grandes)
+    bool* temPista;         // Marca salas com pista
+} GrafoMansao;
+
+#define SEM_CAMINHO -1
+
+// ============================================================================
+// PROTÓTIPOS DAS FUNÇÕES
+// ============================================================================
+
+// construirGrafo() – monta o CSR a partir de uma lista de portas.
+GrafoMansao* construirGrafo(int qtdSalas, Porta* portas, int qtdPortas, bool duasMaos);
+
+// bfsDistancias() – menor número de movimentos da origem até cada sala.
+int bfsDistancias(GrafoMansao* g, int origem, int* distancia, int* anterior);
+
+// rotaAtePista() – BFS que para na primeira sala com pista.
+int rotaAtePista(GrafoMansao* g, int origem, int* anterior);
+
+// dijkstra() – menor custo da origem até cada sala.
+void dijkstra(GrafoMansao* g, int origem, long* custoTotal, int* anterior);
+
+// contarAlcancaveis() – quantas salas podem ser visitadas a partir da origem.
+int contarAlcancaveis(GrafoMansao* g, int origem);
+
+// Funções auxiliares
+void exibirRota(GrafoMansao* g, int* anterior, int destino);
+void liberarGrafo(GrafoMansao* g);
+void testarMansaoGrande(int qtdSalas, int qtdPortas);
+
+// ============================================================================
+// FUNÇÃO PRINCIPAL
+// ============================================================================
+
+int main() {
+    // 1. Mansão com ciclos e salas com várias portas
+    char* nomes[] = {
+        "Hall de Entrada", "Sala de Estar", "Cozinha", "Biblioteca",
+        "Jardim de Inverno", "Sala de Jantar", "Porão", "Escritório"
+    };
+    int qtdSalas = 8;
+
+    Porta portas[] = {
+        {0, 1, 2}, {0, 2, 3}, {0, 7, 6},   // Hall tem três portas
+        {1, 3, 2}, {1, 4, 4}, {1, 5, 1},   // Sala de Estar liga três cômodos
+        {2, 5, 1}, {2, 6, 5},              // Cozinha -> Jantar forma um ciclo
+        {3, 7, 1},                         // Passagem secreta Biblioteca <-> Escritório
+        {4, 5, 2}
+    };
+    int qtdPortas = sizeof(portas) / sizeof(portas[0]);
+
+    GrafoMansao* mansao = construirGrafo(qtdSalas, portas, qtdPortas, true);
+    mansao->nomes = malloc(qtdSalas * sizeof(*mansao->nomes));
+    if (mansao->nomes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (int i = 0; i < qtdSalas; i++) strcpy(mansao->nomes[i], nomes[i]);
+    mansao->temPista[4] = true; // Jardim de Inverno
+    mansao->temPista[6] = true; // Porão
+
+    printf("=========================================\n");
+    printf("   DETECTIVE QUEST: MANSÃO EM GRAFO      \n");
+    printf("=========================================\n");
+
+    // 2. Portas de cada sala
+    for (int v = 0; v < qtdSalas; v++) {
+        printf("%-18s -> ", mansao->nomes[v]);
+        for (int i = mansao->inicio[v]; i < mansao->inicio[v + 1]; i++) {
+            printf("%s%s", mansao->nomes[mansao->destino[i]], (i + 1 < mansao->inicio[v + 1]) ? ", " : "");
+        }
+        printf("\n");
+    }
+
+    int* anterior = malloc(qtdSalas * sizeof(int));
+    int* distancia = malloc(qtdSalas * sizeof(int));
+    long* custoTotal = malloc(qtdSalas * sizeof(long));
+    if (!anterior || !distancia || !custoTotal) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+
+    // 3. Rota mais curta (em movimentos) até a pista mais próxima
+    int alvo = rotaAtePista(mansao, 3, anterior);
+    printf("\nPista mais próxima da Biblioteca: ");
+    if (alvo == SEM_CAMINHO) printf("nenhuma alcançável.\n");
+    else exibirRota(mansao, anterior, alvo);
+
+    // 4. Rota de menor custo do Hall até o Porão
+    dijkstra(mansao, 0, custoTotal, anterior);
+    printf("Caminho mais rápido Hall -> Porão (custo %ld): ", custoTotal[6]);
+    exibirRota(mansao, anterior, 6);
+
+    // 5. Alcance
+    bfsDistancias(mansao, 0, distancia, NULL);
+    printf("Salas alcançáveis a partir do Hall: %d de %d\n", contarAlcancaveis(mansao, 0), qtdSalas);
+    printf("Movimentos do Hall até o Escritório: %d\n", distancia[7]);
+
+    free(anterior);
+    free(distancia);
+    free(custoTotal);
+    liberarGrafo(mansao);
+
+    // 6. Medição com milhões de portas
+    testarMansaoGrande(100000, 1000000);
+    testarMansaoGrande(1000000, 8000000);
+
+    printf("\nMemória liberada. Fim do programa.\n");
+    return 0;
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES
+// ============================================================================
+
+// Auxiliar: malloc que encerra o programa em caso de falha
+static void* alocar(size_t bytes) {
+    void* p = malloc(bytes);
+    if (p == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    return p;
+}
+
+/*
+ * construirGrafo() – monta o CSR a partir de uma lista de portas.
+ * Usa counting sort pela sala de origem: conta as portas de cada sala,
+ * calcula os inícios por soma de prefixos e depois preenche os vetores.
+ * Se duasMaos for true, cada porta é gravada nos dois sentidos.
+ */
+GrafoMansao* construirGrafo(int qtdSalas, Porta* portas, int qtdPortas, bool duasMaos) {
+    GrafoMansao* g = (GrafoMansao*) alocar(sizeof(GrafoMansao));
+    int total = duasMaos ? 2 * qtdPortas : qtdPortas;
+
+    g->qtdSalas = qtdSalas;
+    g->qtdArestas = total;
+    g->inicio = (int*) calloc(qtdSalas + 1, sizeof(int));
+    g->destino = (int*) alocar((total > 0 ? total : 1) * sizeof(int));
+    g->custo = (int*) alocar((total > 0 ? total : 1) * sizeof(int));
+    g->temPista = (bool*) calloc(qtdSalas, sizeof(bool));
+    g->nomes = NULL;
+    if (g->inicio == NULL || g->temPista == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+
+    // 1. Grau de saída de cada sala (guardado em inicio[v + 1])
+    for (int i = 0; i < qtdPortas; i++) {
+        g->inicio[portas[i].origem + 1]++;
+        if (duasMaos) g->inicio[portas[i].destino + 1]++;
+    }
+
+    // 2. Soma de prefixos: inicio[v] passa a ser a posição da primeira porta de v
+    for (int v = 0; v < qtdSalas; v++) g->inicio[v + 1] += g->inicio[v];
+
+    // 3. Preenchimento usando um cursor por sala
+    int* cursor = (int*) alocar((qtdSalas > 0 ? qtdSalas : 1) * sizeof(int));
+    memcpy(cursor, g->inicio, qtdSalas * sizeof(int));
+    for (int i = 0; i < qtdPortas; i++) {
+        int pos = cursor[portas[i].origem]++;
+        g->destino[pos] = portas[i].destino;
+        g->custo[pos] = portas[i].custo;
+        if (duasMaos) {
+            pos = cursor[portas[i].destino]++;
+            g->destino[pos] = portas[i].origem;
+            g->custo[pos] = portas[i].custo;
+        }
+    }
+    free(cursor);
+    return g;
+}
+
+/*
+ * bfsDistancias() – menor número de movimentos da origem até cada sala.
+ * A fila é um vetor simples: cada sala entra no máximo uma vez.
+ * distancia[v] fica SEM_CAMINHO para salas inalcançáveis.
+ * Retorna a quantidade de salas alcançadas.
+ */
+int bfsDistancias(GrafoMansao* g, int origem, int* distancia, int* anterior) {
+    int* fila = (int*) alocar(g->qtdSalas * sizeof(int));
+    int frente = 0, fim = 0;
+
+    for (int v = 0; v < g->qtdSalas; v++) {
+        distancia[v] = SEM_CAMINHO;
+        if (anterior) anterior[v] = SEM_CAMINHO;
+    }
+
+    distancia[origem] = 0;
+    fila[fim++] = origem;
+    while (frente < fim) {
+        int v = fila[frente++];
+        for (int i = g->inicio[v]; i < g->inicio[v + 1]; i++) {
+            int w = g->destino[i];
+            if (distancia[w] == SEM_CAMINHO) {
+                distancia[w] = distancia[v] + 1;
+                if (anterior) anterior[w] = v;
+                fila[fim++] = w;
+            }
+        }
+    }
+
+    free(fila);
+    return fim;
+}
+
+/*
+ * rotaAtePista() – BFS que para na primeira sala com pista.
+ * Como a BFS visita as salas em ordem de distância, a primeira pista
+ * encontrada é a mais próxima. Retorna a sala ou SEM_CAMINHO.
+ */
+int rotaAtePista(GrafoMansao* g, int origem, int* anterior) {
+    int* fila = (int*) alocar(g->qtdSalas * sizeof(int));
+    bool* visitada = (bool*) calloc(g->qtdSalas, sizeof(bool));
+    if (visitada == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    int frente = 0, fim = 0, encontrada = SEM_CAMINHO;
+
+    for (int v = 0; v < g->qtdSalas; v++) anterior[v] = SEM_CAMINHO;
+
+    visitada[origem] = true;
+    fila[fim++] = origem;
+    while (frente < fim && encontrada == SEM_CAMINHO) {
+        int v = fila[frente++];
+        if (g->temPista[v] && v != origem) {
+            encontrada = v;
+            break;
+        }
+        for (int i = g->inicio[v]; i < g->inicio[v + 1]; i++) {
+            int w = g->destino[i];
+            if (!visitada[w]) {
+                visitada[w] = true;
+                anterior[w] = v;
+                fila[fim++] = w;
+            }
+        }
+    }
+
+    free(fila);
+    free(visitada);
+    return encontrada;
+}
+
+// --- Heap binário de mínimo usado pelo Dijkstra ---
+
+typedef struct {
+    long custo;
+    int sala;
+} ItemHeap;
+
+typedef struct {
+    ItemHeap* itens;
+    int tamanho;
+    int capacidade;
+} Heap;
+
+static void empilharHeap(Heap* h, long custo, int sala) {
+    if (h->tamanho == h->capacidade) {
+        h->capacidade *= 2;
+        h->itens = (ItemHeap*) realloc(h->itens, h->capacidade * sizeof(ItemHeap));
+        if (h->itens == NULL) {
+            printf("Erro crítico: Falha na alocação de memória.\n");
+            exit(1);
+        }
+    }
+    // Sobe o novo item até a posição correta
+    int i = h->tamanho++;
+    while (i > 0) {
+        int p = (i - 1) / 2;
+        if (h->itens[p].custo <= custo) break;
+        h->itens[i] = h->itens[p];
+        i = p;
+    }
+    h->itens[i].custo = custo;
+    h->itens[i].sala = sala;
+}
+
+static ItemHeap removerMinHeap(Heap* h) {
+    ItemHeap menor = h->itens[0];
+    ItemHeap ultimo = h->itens[--h->tamanho];
+    // Desce o último item a partir da raiz
+    int i = 0;
+    while (1) {
+        int f = 2 * i + 1;
+        if (f >= h->tamanho) break;
+        if (f + 1 < h->tamanho && h->itens[f + 1].custo < h->itens[f].custo) f++;
+        if (ultimo.custo <= h->itens[f].custo) break;
+        h->itens[i] = h->itens[f];
+        i = f;
+    }
+    if (h->tamanho > 0) h->itens[i] = ultimo;
+    return menor;
+}
+
+/*
+ * dijkstra() – menor custo da origem até cada sala.
+ * Usa remoção preguiçosa: uma sala pode entrar mais de uma vez no heap,
+ * e entradas desatualizadas são descartadas ao sair.
+ * custoTotal[v] fica SEM_CAMINHO para salas inalcançáveis.
+ */
+void dijkstra(GrafoMansao* g, int origem, long* custoTotal, int* anterior) {
+    Heap h;
+    h.capacidade = 1024;
+    h.tamanho = 0;
+    h.itens = (ItemHeap*) alocar(h.capacidade * sizeof(ItemHeap));
+
+    for (int v = 0; v < g->qtdSalas; v++) {
+        custoTotal[v] = SEM_CAMINHO;
+        if (anterior) anterior[v] = SEM_CAMINHO;
+    }
+
+    custoTotal[origem] = 0;
+    empilharHeap(&h, 0, origem);
+    while (h.tamanho > 0) {
+        ItemHeap item = removerMinHeap(&h);
+        int v = item.sala;
+        if (item.custo != custoTotal[v]) continue; // Entrada desatualizada
+
+        for (int i = g->inicio[v]; i < g->inicio[v + 1]; i++) {
+            int w = g->destino[i];
+            long novo = item.custo + g->custo[i];
+            if (custoTotal[w] == SEM_CAMINHO || novo < custoTotal[w]) {
+                custoTotal[w] = novo;
+                if (anterior) anterior[w] = v;
+                empilharHeap(&h, novo, w);
+            }
+        }
+    }
+
+    free(h.itens);
+}
+
+/*
+ * contarAlcancaveis() – quantas salas podem ser visitadas a partir da origem.
+ */
+int contarAlcancaveis(GrafoMansao* g, int origem) {
+    int* distancia = (int*) alocar(g->qtdSalas * sizeof(int));
+    int total = bfsDistancias(g, origem, distancia, NULL);
+    free(distancia);
+    return total;
+}
+
+/*
+ * exibirRota() – imprime o caminho da origem até o destino seguindo
+ * o vetor de anteriores (montado de trás para frente).
+ */
+void exibirRota(GrafoMansao* g, int* anterior, int destino) {
+    int tamanho = 0;
+    for (int v = destino; v != SEM_CAMINHO; v = anterior[v]) tamanho++;
+
+    int* caminho = (int*) alocar(tamanho * sizeof(int));
+    int i = tamanho;
+    for (int v = destino; v != SEM_CAMINHO; v = anterior[v]) caminho[--i] = v;
+
+    for (i = 0; i < tamanho; i++) {
+        if (g->nomes) printf("%s", g->nomes[caminho[i]]);
+        else printf("%d", caminho[i]);
+        if (i + 1 < tamanho) printf(" -> ");
+    }
+    printf("\n");
+    free(caminho);
+}
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+static int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+/*
+ * testarMansaoGrande() – gera uma mansão aleatória com muitas portas e mede
+ * a construção do CSR, a BFS completa, a busca da pista mais próxima e o Dijkstra.
+ */
+void testarMansaoGrande(int qtdSalas, int qtdPortas) {
+    printf("\n=========================================\n");
+    printf("   TESTE: %d SALAS, %d PORTAS (x2 sentidos)\n", qtdSalas, qtdPortas);
+    printf("=========================================\n");
+
+    srand(42);
+    Porta* portas = (Porta*) alocar(qtdPortas * sizeof(Porta));
+    for (int i = 0; i < qtdPortas; i++) {
+        portas[i].origem = aleatorio() % qtdSalas;
+        portas[i].destino = aleatorio() % qtdSalas;
+        portas[i].custo = 1 + rand() % 100;
+    }
+
+    clock_t inicio = clock();
+    GrafoMansao* g = construirGrafo(qtdSalas, portas, qtdPortas, true);
+    clock_t fim = clock();
+    free(portas);
+    printf("Construção do CSR: %f segundos\n", ((double)(fim - inicio)) / CLOCKS_PER_SEC);
+
+    // Uma pista a cada mil salas
+    for (int v = 0; v < qtdSalas; v += 1000) g->temPista[v] = true;
+
+    int* distancia = (int*) alocar(qtdSalas * sizeof(int));
+    int* anterior = (int*) alocar(qtdSalas * sizeof(int));
+    long* custoTotal = (long*) alocar(qtdSalas * sizeof(long));
+
+    inicio = clock();
+    int alcancadas = bfsDistancias(g, 1, distancia, NULL);
+    fim = clock();
+    double tempo = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    printf("BFS completa: %f segundos (%d salas alcançadas, %.1f milhões de arestas/s)\n",
+           tempo, alcancadas, tempo > 0 ? g->qtdArestas / tempo / 1e6 : 0.0);
+
+    inicio = clock();
+    int pista = rotaAtePista(g, 1, anterior);
+    fim = clock();
+    printf("Pista mais próxima da sala 1: sala %d a %d movimentos (%f segundos)\n",
+           pista, pista == SEM_CAMINHO ? -1 : distancia[pista],
+           ((double)(fim - inicio)) / CLOCKS_PER_SEC);
+
+    inicio = clock();
+    dijkstra(g, 1, custoTotal, NULL);
+    fim = clock();
+    printf("Dijkstra completo: %f segundos\n", ((double)(fim - inicio)) / CLOCKS_PER_SEC);
+
+    long memoria = (long)(g->qtdSalas + 1) * sizeof(int) + (long)g->qtdArestas * 2 * sizeof(int);
+    printf("Memória do grafo (CSR): %.1f MB\n", memoria / (1024.0 * 1024.0));
+
+    free(distancia);
+    free(anterior);
+    free(custoTotal);
+    liberarGrafo(g);
+}
+
+void liberarGrafo(GrafoMansao* g) {
+    if (g == NULL) return;
+    free(g->inicio);
+    free(g->destino);
+    free(g->custo);
+    free(g->nomes);
+    free(g->temPista);
+    free(g);
+}
@@ -7,13 +7,30 @@
  * Estruturas:
  *   1. Árvore Binária: Representa o mapa da mansão (Salas).
  *   2. BST (Binary Search Tree): Armazena as pistas coletadas em ordem alfabética.
- *   3. Tabela Hash: Associa pistas a suspeitos para o veredito final.
+ *   3. Gabarito fixo (pista -> suspeito): hash perfeito mínimo gerado antes
+ *      da compilação (Gabarito_Pistas.h, a partir de gabarito_pistas.txt).
+ *      Nada é inserido ao iniciar e cada consulta é uma única sondagem.
+ *   4. Tabela Hash: associações adicionadas durante o jogo (vazia no caso
+ *      padrão); tem prioridade sobre o gabarito. Trocar o suspeito de uma
+ *      pista já coletada move a prova dela para o novo suspeito.
+ *      Hash FNV-1a de 64 bits e encadeamento; a tabela dobra de tamanho
+ *      quando a carga passa de 0.75, então as listas continuam curtas.
+ *   5. Placar de evidências: um contador por suspeito, atualizado quando uma
+ *      pista nova entra na BST. Veredito e ranking não percorrem a BST.
+ *
+ * Depois de editar gabarito_pistas.txt, gere o cabeçalho de novo:
+ *   gcc -O2 Gerador_Hash_Perfeito.c -o Gerador_Hash_Perfeito
+ *   ./Gerador_Hash_Perfeito gabarito_pistas.txt Gabarito_Pistas.h
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Gabarito_Pistas.h"
 
 // ============================================================================
 // DEFINIÇÃO DAS ESTRUTURAS
@@ -38,10 +55,33 @@ typedef struct Sala {
 typedef struct HashNode {
     char pista[100];
     char suspeito[50];
+    int idSuspeito;           // Posição do suspeito no PlacarSuspeitos
+    uint64_t hash;            // Hash completo da pista (não é recalculado ao crescer)
     struct HashNode* proximo; // Tratamento de colisão por encadeamento
 } HashNode;
 
-#define TAM_HASH 31 // Tamanho primo para a tabela hash
+// Tabela Hash com encadeamento e crescimento automático
+typedef struct {
+    HashNode** baldes;
+    int capacidade;           // Sempre potência de 2 (índice = hash & (capacidade - 1))
+    int qtd;
+} TabelaHash;
+
+#define CAPACIDADE_INICIAL_HASH 32
+#define CARGA_MAXIMA_HASH 0.75 // Acima disso a tabela dobra de tamanho
+
+// Placar de evidências: provas[id] = pistas coletadas contra o suspeito id
+#define MAX_SUSPEITOS 32
+
+typedef struct {
+    char nomes[MAX_SUSPEITOS][50];
+    int provas[MAX_SUSPEITOS];
+    int qtd;
+} PlacarSuspeitos;
+
+#if GABARITO_QTD_SUSPEITOS > MAX_SUSPEITOS
+#error "Gabarito_Pistas.h tem mais suspeitos que MAX_SUSPEITOS"
+#endif
 
 // ============================================================================
 // PROTÓTIPOS DAS FUNÇÕES
@@ -51,26 +91,47 @@ typedef struct HashNode {
 Sala* criarSala(char* nome, char* pista);
 
 // inserirPista() – insere a pista coletada na árvore de pistas.
-PistaNode* inserirPista(PistaNode* raiz, char* conteudo);
+// *nova fica true se a pista ainda não estava na árvore.
+PistaNode* inserirPista(PistaNode* raiz, char* conteudo, bool* nova);
+
+// pistaColetada() – true se a pista já está na árvore de pistas.
+bool pistaColetada(PistaNode* raiz, char* conteudo);
 
 // explorarSalas() – navega pela árvore e ativa o sistema de pistas.
-void explorarSalas(Sala* mapa, PistaNode** raizPistas);
+// Cada pista nova soma uma prova ao suspeito dela no placar.
+void explorarSalas(Sala* mapa, PistaNode** raizPistas, TabelaHash* tabela, PlacarSuspeitos* placar);
 
-// inserirNaHash() – insere associação pista/suspeito na tabela hash.
-void inserirNaHash(HashNode* tabela[], char* pista, char* suspeito);
+// iniciarHash() – prepara uma tabela hash vazia.
+void iniciarHash(TabelaHash* tabela);
+
+// inserirNaHash() – insere associação pista/suspeito na tabela hash
+// (e o suspeito no placar, se ainda não estiver lá). Se a pista já foi
+// coletada, a prova dela passa do suspeito antigo para o novo.
+void inserirNaHash(TabelaHash* tabela, PlacarSuspeitos* placar, PistaNode* coletadas, char* pista, char* suspeito);
+
+// encontrarPistaHash() – nó da tabela correspondente a uma pista (ou NULL).
+HashNode* encontrarPistaHash(TabelaHash* tabela, char* pista);
+
+// suspeitoDaPista() – ID do suspeito ligado à pista (tabela, depois gabarito), ou -1.
+int suspeitoDaPista(TabelaHash* tabela, char* pista);
 
 // encontrarSuspeito() – consulta o suspeito correspondente a uma pista.
-char* encontrarSuspeito(HashNode* tabela[], char* pista);
+char* encontrarSuspeito(TabelaHash* tabela, char* pista);
+
+// Placar de evidências: registro de suspeitos, consulta e ranking.
+void iniciarPlacar(PlacarSuspeitos* placar);
+int registrarSuspeito(PlacarSuspeitos* placar, char* nome);
+int provasContra(PlacarSuspeitos* placar, char* nome);
+void exibirRanking(PlacarSuspeitos* placar);
 
 // verificarSuspeitoFinal() – conduz à fase de julgamento final.
-void verificarSuspeitoFinal(PistaNode* raizPistas, HashNode* tabela[], char* suspeitoAcusado);
+void verificarSuspeitoFinal(PlacarSuspeitos* placar, char* suspeitoAcusado);
 
 // Funções auxiliares
 void exibirPistas(PistaNode* raiz);
 void liberarMapa(Sala* raiz);
 void liberarPistas(PistaNode* raiz);
-void liberarHash(HashNode* tabela[]);
-int contarPistasSuspeito(PistaNode* raiz, HashNode* tabela[], char* suspeitoAlvo);
+void liberarHash(TabelaHash* tabela);
 
 // ============================================================================
 // FUNÇÃO PRINCIPAL
@@ -92,19 +153,14 @@ int main() {
     // 2. Inicialização da Árvore de Pistas (Inventário vazio)
     PistaNode* inventarioPistas = NULL;
 
-    // 3. Inicialização e Configuração da Tabela Hash
-    HashNode* tabelaSuspeitos[TAM_HASH] = {NULL};
-    
-    // Configuração das pistas e suspeitos (Gabarito do Jogo)
-    // Jardineiro
-    inserirNaHash(tabelaSuspeitos, "Pegadas de lama no chão", "Jardineiro");
-    inserirNaHash(tabelaSuspeitos, "Terra revirada recente", "Jardineiro");
-    // Mordomo
-    inserirNaHash(tabelaSuspeitos, "Relógio parado às 10h", "Mordomo");
-    inserirNaHash(tabelaSuspeitos, "Taça de vinho quebrada", "Mordomo");
-    // Governanta
-    inserirNaHash(tabelaSuspeitos, "Livro de venenos aberto", "Governanta");
-    inserirNaHash(tabelaSuspeitos, "Chave enferrujada antiga", "Governanta");
+    // 3. Gabarito e Tabela Hash
+    // O gabarito do jogo já vem pronto em Gabarito_Pistas.h (constante).
+    // A tabela hash começa vazia: só recebe associações criadas em tempo de
+    // execução, com inserirNaHash(&tabelaSuspeitos, &placar, inventarioPistas, pista, suspeito).
+    TabelaHash tabelaSuspeitos;
+    iniciarHash(&tabelaSuspeitos);
+    PlacarSuspeitos placar;
+    iniciarPlacar(&placar);
 
     printf("=========================================\n");
     printf("      DETECTIVE QUEST: O ÚLTIMO CASO     \n");
@@ -112,7 +168,7 @@ int main() {
     printf("Você entrou na mansão. Explore os cômodos e colete evidências.\n");
 
     // 4. Início da Exploração
-    explorarSalas(mansao, &inventarioPistas);
+    explorarSalas(mansao, &inventarioPistas, &tabelaSuspeitos, &placar);
 
     // 5. Relatório Final
     printf("\n=========================================\n");
@@ -125,6 +181,8 @@ int main() {
     } else {
         exibirPistas(inventarioPistas);
     }
+    printf("\nEvidências por suspeito:\n");
+    exibirRanking(&placar);
     printf("=========================================\n");
 
     // 6. Fase de Acusação
@@ -132,12 +190,12 @@ int main() {
     printf("\nQuem é o culpado? (Jardineiro / Mordomo / Governanta): ");
     scanf(" %[^\n]s", acusado); // Lê string com espaços
 
-    verificarSuspeitoFinal(inventarioPistas, tabelaSuspeitos, acusado);
+    verificarSuspeitoFinal(&placar, acusado);
 
     // 7. Limpeza de Memória
     liberarMapa(mansao);
     liberarPistas(inventarioPistas);
-    liberarHash(tabelaSuspeitos);
+    liberarHash(&tabelaSuspeitos);
     printf("\nMemória liberada. Caso encerrado.\n");
 
     return 0;
@@ -175,7 +233,7 @@ Sala* criarSala(char* nome, char* pista) {
  * Utiliza a lógica de BST (Binary Search Tree) para manter as pistas
  * ordenadas alfabeticamente.
  */
-PistaNode* inserirPista(PistaNode* raiz, char* conteudo) {
+PistaNode* inserirPista(PistaNode* raiz, char* conteudo, bool* nova) {
     if (raiz == NULL) {
         PistaNode* novo = (PistaNode*)malloc(sizeof(PistaNode));
         if (novo) {
@@ -183,24 +241,40 @@ PistaNode* inserirPista(PistaNode* raiz, char* conteudo) {
             novo->esquerda = NULL;
             novo->direita = NULL;
         }
+        *nova = (novo != NULL);
         return novo;
     }
 
     int cmp = strcmp(conteudo, raiz->conteudo);
 
     if (cmp < 0) {
-        raiz->esquerda = inserirPista(raiz->esquerda, conteudo);
+        raiz->esquerda = inserirPista(raiz->esquerda, conteudo, nova);
     } else if (cmp > 0) {
-        raiz->direita = inserirPista(raiz->direita, conteudo);
+        raiz->direita = inserirPista(raiz->direita, conteudo, nova);
+    } else {
+        *nova = false; // Já estava no caderno
     }
     return raiz;
 }
 
+/*
+ * pistaColetada() – busca exata na árvore de pistas.
+ */
+bool pistaColetada(PistaNode* raiz, char* conteudo) {
+    while (raiz != NULL) {
+        int cmp = strcmp(conteudo, raiz->conteudo);
+        if (cmp == 0) return true;
+        raiz = (cmp < 0) ? raiz->esquerda : raiz->direita;
+    }
+    return false;
+}
+
 /*
  * explorarSalas() – navega pela árvore e ativa o sistema de pistas.
  * Permite ao usuário escolher caminhos (esquerda/direita) e coleta pistas automaticamente.
+ * A prova entra no placar aqui, uma vez por pista distinta.
  */
-void explorarSalas(Sala* salaAtual, PistaNode** raizPistas) {
+void explorarSalas(Sala* salaAtual, PistaNode** raizPistas, TabelaHash* tabela, PlacarSuspeitos* placar) {
     char opcao;
     
     while (salaAtual != NULL) {
@@ -211,7 +285,12 @@ void explorarSalas(Sala* salaAtual, PistaNode** raizPistas) {
         if (strlen(salaAtual->pista) > 0) {
             printf("[!] Pista encontrada: \"%s\"\n", salaAtual->pista);
             printf("    -> Adicionando ao caderno de anotações...\n");
-            *raizPistas = inserirPista(*raizPistas, salaAtual->pista);
+            bool nova;
+            *raizPistas = inserirPista(*raizPistas, salaAtual->pista, &nova);
+            if (nova) {
+                int idSuspeito = suspeitoDaPista(tabela, salaAtual->pista);
+                if (idSuspeito >= 0) placar->provas[idSuspeito]++;
+            }
         } else {
             printf("(Nenhuma pista visível neste cômodo)\n");
         }
@@ -251,73 +330,232 @@ void explorarSalas(Sala* salaAtual, PistaNode** raizPistas) {
 
 // --- Funções da Tabela Hash ---
 
-int funcaoHash(char* chave) {
-    int soma = 0;
-    for (int i = 0; chave[i] != '\0'; i++) {
-        soma += chave[i];
+/*
+ * funcaoHash() – FNV-1a de 64 bits.
+ * Cada byte altera todos os bits seguintes, então anagramas e pistas
+ * parecidas caem em posições diferentes (a soma dos caracteres não
+ * distinguia "Taça" de "açaT"). Os bytes são lidos sem sinal, então
+ * acentos UTF-8 não geram índices negativos.
+ */
+uint64_t funcaoHash(const char* chave) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const unsigned char* c = (const unsigned char*)chave; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
     }
-    return soma % TAM_HASH;
+    return hash;
+}
+
+// Auxiliar: índice do balde. Os bits altos são misturados aos baixos,
+// porque a máscara só usa os bits baixos do hash.
+int indiceHash(TabelaHash* tabela, uint64_t hash) {
+    return (int)((hash ^ (hash >> 32)) & (uint64_t)(tabela->capacidade - 1));
+}
+
+/*
+ * iniciarHash() – prepara uma tabela hash vazia.
+ */
+void iniciarHash(TabelaHash* tabela) {
+    tabela->capacidade = CAPACIDADE_INICIAL_HASH;
+    tabela->qtd = 0;
+    tabela->baldes = (HashNode**)calloc(tabela->capacidade, sizeof(HashNode*));
+    if (tabela->baldes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+}
+
+/*
+ * crescerHash() – dobra o número de baldes e redistribui os nós.
+ * Os nós são reaproveitados (sem malloc por pista) e o hash guardado em
+ * cada um evita ler as pistas de novo.
+ */
+void crescerHash(TabelaHash* tabela) {
+    HashNode** antigos = tabela->baldes;
+    int capacidadeAntiga = tabela->capacidade;
+    tabela->capacidade *= 2;
+    tabela->baldes = (HashNode**)calloc(tabela->capacidade, sizeof(HashNode*));
+    if (tabela->baldes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (int i = 0; i < capacidadeAntiga; i++) {
+        HashNode* atual = antigos[i];
+        while (atual != NULL) {
+            HashNode* proximo = atual->proximo;
+            int indice = indiceHash(tabela, atual->hash);
+            atual->proximo = tabela->baldes[indice];
+            tabela->baldes[indice] = atual;
+            atual = proximo;
+        }
+    }
+    free(antigos);
 }
 
 /*
  * inserirNaHash() – insere associação pista/suspeito na tabela hash.
  * Cria um novo nó e o insere na lista encadeada correspondente ao índice hash.
+ * Se a pista já existe, apenas troca o suspeito.
+ * O placar só soma provas na coleta, então uma pista que já está no caderno
+ * tem a sua prova movida aqui do suspeito anterior (tabela ou gabarito) para o novo.
  */
-void inserirNaHash(HashNode* tabela[], char* pista, char* suspeito) {
-    int indice = funcaoHash(pista);
+void inserirNaHash(TabelaHash* tabela, PlacarSuspeitos* placar, PistaNode* coletadas, char* pista, char* suspeito) {
+    int idSuspeito = registrarSuspeito(placar, suspeito);
+    if (pistaColetada(coletadas, pista)) {
+        int idAnterior = suspeitoDaPista(tabela, pista);
+        if (idAnterior != idSuspeito) {
+            if (idAnterior >= 0) placar->provas[idAnterior]--;
+            placar->provas[idSuspeito]++;
+        }
+    }
+    uint64_t hash = funcaoHash(pista);
+    int indice = indiceHash(tabela, hash);
+    for (HashNode* atual = tabela->baldes[indice]; atual != NULL; atual = atual->proximo) {
+        if (atual->hash == hash && strcmp(atual->pista, pista) == 0) {
+            strcpy(atual->suspeito, suspeito);
+            atual->idSuspeito = idSuspeito;
+            return;
+        }
+    }
+
+    if (tabela->qtd + 1 > CARGA_MAXIMA_HASH * tabela->capacidade) {
+        crescerHash(tabela);
+        indice = indiceHash(tabela, hash);
+    }
     HashNode* novo = (HashNode*)malloc(sizeof(HashNode));
     if (novo) {
         strcpy(novo->pista, pista);
         strcpy(novo->suspeito, suspeito);
-        novo->proximo = tabela[indice];
-        tabela[indice] = novo;
+        novo->idSuspeito = idSuspeito;
+        novo->hash = hash;
+        novo->proximo = tabela->baldes[indice];
+        tabela->baldes[indice] = novo;
+        tabela->qtd++;
     }
 }
 
 /*
- * encontrarSuspeito() – consulta o suspeito correspondente a uma pista.
- * Busca na tabela hash pela pista fornecida e retorna o nome do suspeito.
+ * encontrarPistaHash() – nó da tabela correspondente a uma pista.
+ * O strcmp só roda quando o hash de 64 bits é igual.
  */
-char* encontrarSuspeito(HashNode* tabela[], char* pista) {
-    int indice = funcaoHash(pista);
-    HashNode* atual = tabela[indice];
+HashNode* encontrarPistaHash(TabelaHash* tabela, char* pista) {
+    uint64_t hash = funcaoHash(pista);
+    HashNode* atual = tabela->baldes[indiceHash(tabela, hash)];
     
     while (atual != NULL) {
-        if (strcmp(atual->pista, pista) == 0) {
-            return atual->suspeito;
+        if (atual->hash == hash && strcmp(atual->pista, pista) == 0) {
+            return atual;
         }
         atual = atual->proximo;
     }
     return NULL;
 }
 
-// Função auxiliar recursiva para contar pistas de um suspeito na BST
-int contarPistasSuspeito(PistaNode* raiz, HashNode* tabela[], char* suspeitoAlvo) {
-    if (raiz == NULL) return 0;
-    
-    int contador = 0;
-    char* suspeitoDaPista = encontrarSuspeito(tabela, raiz->conteudo);
-    
-    // Verifica se a pista atual aponta para o suspeito alvo
-    if (suspeitoDaPista != NULL && strcmp(suspeitoDaPista, suspeitoAlvo) == 0) {
-        contador = 1;
+/*
+ * suspeitoDaPista() – ID do suspeito ligado à pista.
+ * Associações de tempo de execução vêm primeiro (podem substituir o
+ * gabarito); com a tabela vazia, o custo é só o do hash perfeito.
+ */
+int suspeitoDaPista(TabelaHash* tabela, char* pista) {
+    if (tabela->qtd > 0) {
+        HashNode* associacao = encontrarPistaHash(tabela, pista);
+        if (associacao != NULL) return associacao->idSuspeito;
+    }
+    int pos = buscarGabarito(pista);
+    return pos >= 0 ? gabaritoPistas[pos].idSuspeito : -1;
+}
+
+/*
+ * encontrarSuspeito() – consulta o suspeito correspondente a uma pista.
+ * Busca na tabela hash e depois no gabarito e retorna o nome do suspeito.
+ */
+char* encontrarSuspeito(TabelaHash* tabela, char* pista) {
+    if (tabela->qtd > 0) {
+        HashNode* associacao = encontrarPistaHash(tabela, pista);
+        if (associacao != NULL) return associacao->suspeito;
+    }
+    int pos = buscarGabarito(pista);
+    return pos >= 0 ? (char*)gabaritoSuspeitos[gabaritoPistas[pos].idSuspeito] : NULL;
+}
+
+// --- Placar de Evidências ---
+
+/*
+ * iniciarPlacar() – zera o placar com os suspeitos do gabarito.
+ * O ID de cada um é a posição em gabaritoSuspeitos.
+ */
+void iniciarPlacar(PlacarSuspeitos* placar) {
+    placar->qtd = GABARITO_QTD_SUSPEITOS;
+    for (int i = 0; i < GABARITO_QTD_SUSPEITOS; i++) {
+        strcpy(placar->nomes[i], gabaritoSuspeitos[i]);
+        placar->provas[i] = 0;
+    }
+}
+
+// Auxiliar: posição do suspeito no placar (-1 se não existe)
+int buscarSuspeito(PlacarSuspeitos* placar, char* nome) {
+    for (int i = 0; i < placar->qtd; i++) {
+        if (strcmp(placar->nomes[i], nome) == 0) return i;
+    }
+    return -1;
+}
+
+/*
+ * registrarSuspeito() – devolve o ID do suspeito, criando-o com zero provas
+ * se for a primeira vez. Usada pelo inserirNaHash (suspeitos fora do gabarito).
+ */
+int registrarSuspeito(PlacarSuspeitos* placar, char* nome) {
+    int id = buscarSuspeito(placar, nome);
+    if (id >= 0) return id;
+    if (placar->qtd == MAX_SUSPEITOS) {
+        printf("Erro crítico: Limite de %d suspeitos atingido.\n", MAX_SUSPEITOS);
+        exit(1);
+    }
+    id = placar->qtd++;
+    strcpy(placar->nomes[id], nome);
+    placar->provas[id] = 0;
+    return id;
+}
+
+/*
+ * provasContra() – "evidências contra X": leitura do contador.
+ * Suspeito desconhecido tem zero provas.
+ */
+int provasContra(PlacarSuspeitos* placar, char* nome) {
+    int id = buscarSuspeito(placar, nome);
+    return id >= 0 ? placar->provas[id] : 0;
+}
+
+/*
+ * exibirRanking() – suspeitos do mais ao menos incriminado.
+ * Ordena só os IDs (poucos suspeitos); pode ser chamada a qualquer momento.
+ */
+void exibirRanking(PlacarSuspeitos* placar) {
+    int ordem[MAX_SUSPEITOS];
+    for (int i = 0; i < placar->qtd; i++) {
+        // Inserção: empate mantém a ordem de cadastro
+        int j = i;
+        while (j > 0 && placar->provas[ordem[j - 1]] < placar->provas[i]) {
+            ordem[j] = ordem[j - 1];
+            j--;
+        }
+        ordem[j] = i;
+    }
+    for (int i = 0; i < placar->qtd; i++) {
+        printf("%d. %-12s %d prova(s)\n", i + 1, placar->nomes[ordem[i]], placar->provas[ordem[i]]);
     }
-    
-    return contador + 
-           contarPistasSuspeito(raiz->esquerda, tabela, suspeitoAlvo) + 
-           contarPistasSuspeito(raiz->direita, tabela, suspeitoAlvo);
 }
 
 /*
  * verificarSuspeitoFinal() – conduz à fase de julgamento final.
  * Verifica se há provas suficientes (>= 2 pistas) contra o acusado.
  */
-void verificarSuspeitoFinal(PistaNode* raizPistas, HashNode* tabela[], char* suspeitoAcusado) {
+void verificarSuspeitoFinal(PlacarSuspeitos* placar, char* suspeitoAcusado) {
     printf("\n--- JULGAMENTO FINAL ---\n");
     printf("Acusado: %s\n", suspeitoAcusado);
     printf("Analisando evidências coletadas...\n");
     
-    int qtdProvas = contarPistasSuspeito(raizPistas, tabela, suspeitoAcusado);
+    int qtdProvas = provasContra(placar, suspeitoAcusado);
     
     printf("Provas encontradas contra %s: %d\n", suspeitoAcusado, qtdProvas);
     
@@ -359,13 +597,17 @@ void liberarPistas(PistaNode* raiz) {
     }
 }
 
-void liberarHash(HashNode* tabela[]) {
-    for (int i = 0; i < TAM_HASH; i++) {
-        HashNode* atual = tabela[i];
+void liberarHash(TabelaHash* tabela) {
+    for (int i = 0; i < tabela->capacidade; i++) {
+        HashNode* atual = tabela->baldes[i];
         while (atual != NULL) {
             HashNode* temp = atual;
             atual = atual->proximo;
             free(temp);
         }
     }
+    free(tabela->baldes);
+    tabela->baldes = NULL;
+    tabela->capacidade = 0;
+    tabela->qtd = 0;
 }
\ No newline at end of file
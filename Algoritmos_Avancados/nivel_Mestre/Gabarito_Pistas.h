@@ -0,0 +1,62 @@
+/*
+ * Gerado por Gerador_Hash_Perfeito.c a partir de gabarito_pistas.txt. Não editar à mão.
+ *
+ * Hash perfeito mínimo do gabarito pista -> suspeito: 6 pistas em 6
+ * posições, 3 baldes de sementes. Cada busca calcula dois hashes e faz
+ * um único strcmp.
+ */
+
+#ifndef GABARITO_PISTAS_H
+#define GABARITO_PISTAS_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define GABARITO_QTD_PISTAS 6
+#define GABARITO_QTD_BALDES 3
+#define GABARITO_QTD_SUSPEITOS 3
+
+// Suspeitos na ordem do gabarito (o índice é o idSuspeito)
+static const char* const gabaritoSuspeitos[GABARITO_QTD_SUSPEITOS] = {
+    "Jardineiro",
+    "Mordomo",
+    "Governanta",
+};
+
+// Pistas na posição dada pelo hash perfeito
+static const struct {
+    const char* pista;
+    int idSuspeito;
+} gabaritoPistas[GABARITO_QTD_PISTAS] = {
+    {"Terra revirada recente", 0},
+    {"Relógio parado às 10h", 1},
+    {"Chave enferrujada antiga", 2},
+    {"Pegadas de lama no chão", 0},
+    {"Taça de vinho quebrada", 1},
+    {"Livro de venenos aberto", 2},
+};
+
+static const uint16_t gabaritoSementes[GABARITO_QTD_BALDES] = {
+    17, 16, 4
+};
+
+static inline uint64_t hashGabarito(const char* chave, uint64_t semente) {
+    uint64_t hash = 14695981039346656037ULL ^ (semente * 0x9E3779B97F4A7C15ULL);
+    for (const unsigned char* c = (const unsigned char*)chave; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    hash ^= hash >> 32;
+    hash *= 0xD6E8FEB86659FD93ULL;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// Posição da pista em gabaritoPistas, ou -1 se ela não está no gabarito
+static inline int buscarGabarito(const char* pista) {
+    uint32_t semente = gabaritoSementes[hashGabarito(pista, 0) % GABARITO_QTD_BALDES];
+    int pos = (int)(hashGabarito(pista, semente) % GABARITO_QTD_PISTAS);
+    return strcmp(gabaritoPistas[pos].pista, pista) == 0 ? pos : -1;
+}
+
+#endif
@@ -0,0 +1,377 @@
+/*
+ * Objetivo: Gerar, antes da compilação do jogo, um hash perfeito mínimo para
+ *           o gabarito fixo pista -> suspeito do Detective_Quest_Mestre.c.
+ *
+ * Entrada: arquivo texto com linhas "pista;suspeito" (gabarito_pistas.txt).
+ * Saída: cabeçalho C (Gabarito_Pistas.h) com as tabelas constantes e a
+ *        função de busca. O jogo só inclui o cabeçalho: nada é inserido
+ *        ao iniciar.
+ *
+ * Algoritmo (hash e deslocamento, como no CHD):
+ * 1. Cada pista cai em um de R baldes pelo hash com semente 0 (R ~ N/2).
+ * 2. Os baldes são tratados do maior para o menor. Para cada balde procura-se
+ *    uma semente s tal que hash(pista, s) % N leve todas as pistas do balde
+ *    a posições ainda livres.
+ * 3. Busca no jogo: balde = hash(pista, 0) % R; posição =
+ *    hash(pista, sementes[balde]) % N; um strcmp confirma a pista.
+ *    N pistas ocupam exatamente N posições (mínimo) e nunca há colisão.
+ *
+ * Compilação: gcc -O2 Gerador_Hash_Perfeito.c -o Gerador_Hash_Perfeito
+ * Uso: ./Gerador_Hash_Perfeito [gabarito_pistas.txt] [Gabarito_Pistas.h]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MAX_ASSOCIACOES 65536
+#define MAX_SUSPEITOS 32       // Mesmo limite do PlacarSuspeitos do jogo
+#define MAX_SEMENTE (1 << 24)  // Tentativas por balde antes de aumentar a quantidade de baldes
+
+typedef struct {
+    char pista[100];
+    int idSuspeito;
+    int balde;
+} Associacao;
+
+// ============================================================================
+// FUNÇÃO HASH (o mesmo texto é gravado no cabeçalho, ver gravarCabecalho)
+// ============================================================================
+
+uint64_t hashGabarito(const char* chave, uint64_t semente) {
+    uint64_t hash = 14695981039346656037ULL ^ (semente * 0x9E3779B97F4A7C15ULL);
+    for (const unsigned char* c = (const unsigned char*)chave; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    // Mistura final: o resto da divisão depende de todos os bits
+    hash ^= hash >> 32;
+    hash *= 0xD6E8FEB86659FD93ULL;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// ============================================================================
+// LEITURA DO GABARITO
+// ============================================================================
+
+// Auxiliar: remove espaços e quebras de linha do fim
+void aparar(char* texto) {
+    size_t tam = strlen(texto);
+    while (tam > 0 && (texto[tam - 1] == '\n' || texto[tam - 1] == '\r' || texto[tam - 1] == ' ')) texto[--tam] = '\0';
+}
+
+/*
+ * Função: lerGabarito
+ * Lê as associações e numera os suspeitos na ordem em que aparecem.
+ * Retorna a quantidade de associações ou -1 em caso de erro.
+ */
+int lerGabarito(const char* caminho, Associacao* associacoes, char suspeitos[][50], int* qtdSuspeitos) {
+    FILE* arquivo = fopen(caminho, "r");
+    if (arquivo == NULL) {
+        printf("[ERRO] Não foi possível abrir %s.\n", caminho);
+        return -1;
+    }
+    char linha[256];
+    int qtd = 0, numeroLinha = 0;
+    *qtdSuspeitos = 0;
+    while (fgets(linha, sizeof(linha), arquivo) != NULL) {
+        numeroLinha++;
+        aparar(linha);
+        if (linha[0] == '\0' || linha[0] == '#') continue;
+
+        char* separador = strchr(linha, ';');
+        if (separador == NULL || separador == linha || separador[1] == '\0' ||
+            separador - linha >= 100 || strlen(separador + 1) >= 50) {
+            printf("[ERRO] %s:%d: esperado \"pista;suspeito\" (pista < 100, suspeito < 50 bytes).\n",
+                   caminho, numeroLinha);
+            fclose(arquivo);
+            return -1;
+        }
+        *separador = '\0';
+        if (qtd == MAX_ASSOCIACOES) {
+            printf("[ERRO] Mais de %d associações.\n", MAX_ASSOCIACOES);
+            fclose(arquivo);
+            return -1;
+        }
+        for (int i = 0; i < qtd; i++) {
+            if (strcmp(associacoes[i].pista, linha) == 0) {
+                printf("[ERRO] %s:%d: pista repetida \"%s\".\n", caminho, numeroLinha, linha);
+                fclose(arquivo);
+                return -1;
+            }
+        }
+
+        char* suspeito = separador + 1;
+        int id = 0;
+        while (id < *qtdSuspeitos && strcmp(suspeitos[id], suspeito) != 0) id++;
+        if (id == *qtdSuspeitos) {
+            if (id == MAX_SUSPEITOS) {
+                printf("[ERRO] Mais de %d suspeitos.\n", MAX_SUSPEITOS);
+                fclose(arquivo);
+                return -1;
+            }
+            strcpy(suspeitos[id], suspeito);
+            (*qtdSuspeitos)++;
+        }
+        strcpy(associacoes[qtd].pista, linha);
+        associacoes[qtd].idSuspeito = id;
+        qtd++;
+    }
+    fclose(arquivo);
+    return qtd;
+}
+
+// ============================================================================
+// CONSTRUÇÃO DO HASH PERFEITO
+// ============================================================================
+
+// Auxiliar do qsort: baldes com mais pistas primeiro
+int *tamanhosBaldes;
+int compararBaldes(const void* a, const void* b) {
+    int ba = *(const int*)a, bb = *(const int*)b;
+    if (tamanhosBaldes[ba] != tamanhosBaldes[bb]) return tamanhosBaldes[bb] - tamanhosBaldes[ba];
+    return ba - bb;
+}
+
+/*
+ * Função: construirHashPerfeito
+ * Preenche sementes[qtdBaldes] e posicoes[qtd] (posição final de cada
+ * associação). Retorna false se algum balde não achou semente.
+ */
+bool construirHashPerfeito(Associacao* associacoes, int qtd, int qtdBaldes,
+                           uint32_t* sementes, int* posicoes) {
+    int* tamanhos = (int*)calloc(qtdBaldes, sizeof(int));
+    int* inicio = (int*)calloc(qtdBaldes + 1, sizeof(int));
+    int* ordem = (int*)malloc(qtdBaldes * sizeof(int));
+    bool* ocupada = (bool*)calloc(qtd, sizeof(bool));
+    int* membros = (int*)malloc(qtd * sizeof(int));
+    int* tentativa = (int*)malloc(qtd * sizeof(int));
+    if (tamanhos == NULL || inicio == NULL || ordem == NULL || ocupada == NULL || membros == NULL ||
+        tentativa == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+
+    for (int i = 0; i < qtd; i++) {
+        associacoes[i].balde = (int)(hashGabarito(associacoes[i].pista, 0) % qtdBaldes);
+        tamanhos[associacoes[i].balde]++;
+    }
+    // membros[inicio[b] .. inicio[b + 1] - 1]: associações do balde b
+    for (int b = 0; b < qtdBaldes; b++) inicio[b + 1] = inicio[b] + tamanhos[b];
+    for (int i = 0; i < qtd; i++) {
+        int balde = associacoes[i].balde;
+        membros[inicio[balde] + --tamanhos[balde]] = i; // Preenche o trecho do fim para o começo
+    }
+    for (int b = 0; b < qtdBaldes; b++) tamanhos[b] = inicio[b + 1] - inicio[b];
+    for (int b = 0; b < qtdBaldes; b++) {
+        ordem[b] = b;
+        sementes[b] = 0;
+    }
+    tamanhosBaldes = tamanhos;
+    qsort(ordem, qtdBaldes, sizeof(int), compararBaldes);
+
+    bool sucesso = true;
+    for (int k = 0; k < qtdBaldes && sucesso; k++) {
+        int b = ordem[k];
+        if (tamanhos[b] == 0) break; // Os restantes também estão vazios
+        int* doBalde = membros + inicio[b];
+        int qtdMembros = tamanhos[b];
+
+        // Semente 0 já é a do balde; as de deslocamento começam em 1
+        int semente = 1;
+        for (; semente <= MAX_SEMENTE; semente++) {
+            bool serve = true;
+            for (int m = 0; m < qtdMembros && serve; m++) {
+                int pos = (int)(hashGabarito(associacoes[doBalde[m]].pista, semente) % qtd);
+                if (ocupada[pos]) serve = false;
+                for (int j = 0; j < m && serve; j++) {
+                    if (tentativa[j] == pos) serve = false; // Duas pistas do balde na mesma posição
+                }
+                tentativa[m] = pos;
+            }
+            if (serve) break;
+        }
+        if (semente > MAX_SEMENTE) {
+            sucesso = false;
+            break;
+        }
+        sementes[b] = (uint32_t)semente;
+        for (int m = 0; m < qtdMembros; m++) {
+            ocupada[tentativa[m]] = true;
+            posicoes[doBalde[m]] = tentativa[m];
+        }
+    }
+
+    free(tamanhos);
+    free(inicio);
+    free(ordem);
+    free(ocupada);
+    free(membros);
+    free(tentativa);
+    return sucesso;
+}
+
+// ============================================================================
+// GRAVAÇÃO DO CABEÇALHO
+// ============================================================================
+
+// Auxiliar: grava o texto como literal de string C (bytes UTF-8 passam direto)
+void gravarLiteral(FILE* saida, const char* texto) {
+    fputc('"', saida);
+    for (const char* c = texto; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') fputc('\\', saida);
+        fputc(*c, saida);
+    }
+    fputc('"', saida);
+}
+
+bool gravarCabecalho(const char* caminho, const char* origem, Associacao* associacoes, int qtd,
+                     const int* posicoes, uint32_t* sementes, int qtdBaldes,
+                     char suspeitos[][50], int qtdSuspeitos) {
+    FILE* saida = fopen(caminho, "w");
+    if (saida == NULL) {
+        printf("[ERRO] Não foi possível criar %s.\n", caminho);
+        return false;
+    }
+
+    int* naPosicao = (int*)malloc(qtd * sizeof(int));
+    if (naPosicao == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (int i = 0; i < qtd; i++) naPosicao[posicoes[i]] = i;
+
+    fprintf(saida, "/*\n");
+    fprintf(saida, " * Gerado por Gerador_Hash_Perfeito.c a partir de %s. Não editar à mão.\n", origem);
+    fprintf(saida, " *\n");
+    fprintf(saida, " * Hash perfeito mínimo do gabarito pista -> suspeito: %d pistas em %d\n", qtd, qtd);
+    fprintf(saida, " * posições, %d baldes de sementes. Cada busca calcula dois hashes e faz\n", qtdBaldes);
+    fprintf(saida, " * um único strcmp.\n");
+    fprintf(saida, " */\n\n");
+    fprintf(saida, "#ifndef GABARITO_PISTAS_H\n#define GABARITO_PISTAS_H\n\n");
+    fprintf(saida, "#include <stdint.h>\n#include <string.h>\n\n");
+    fprintf(saida, "#define GABARITO_QTD_PISTAS %d\n", qtd);
+    fprintf(saida, "#define GABARITO_QTD_BALDES %d\n", qtdBaldes);
+    fprintf(saida, "#define GABARITO_QTD_SUSPEITOS %d\n\n", qtdSuspeitos);
+
+    fprintf(saida, "// Suspeitos na ordem do gabarito (o índice é o idSuspeito)\n");
+    fprintf(saida, "static const char* const gabaritoSuspeitos[GABARITO_QTD_SUSPEITOS] = {\n");
+    for (int s = 0; s < qtdSuspeitos; s++) {
+        fprintf(saida, "    ");
+        gravarLiteral(saida, suspeitos[s]);
+        fprintf(saida, ",\n");
+    }
+    fprintf(saida, "};\n\n");
+
+    fprintf(saida, "// Pistas na posição dada pelo hash perfeito\n");
+    fprintf(saida, "static const struct {\n    const char* pista;\n    int idSuspeito;\n");
+    fprintf(saida, "} gabaritoPistas[GABARITO_QTD_PISTAS] = {\n");
+    for (int p = 0; p < qtd; p++) {
+        Associacao* a = &associacoes[naPosicao[p]];
+        fprintf(saida, "    {");
+        gravarLiteral(saida, a->pista);
+        fprintf(saida, ", %d},\n", a->idSuspeito);
+    }
+    fprintf(saida, "};\n\n");
+
+    // Sementes pequenas (o caso comum) cabem em 16 bits
+    uint32_t maiorSemente = 0;
+    for (int b = 0; b < qtdBaldes; b++) {
+        if (sementes[b] > maiorSemente) maiorSemente = sementes[b];
+    }
+    const char* tipoSemente = maiorSemente <= 0xFFFF ? "uint16_t" : "uint32_t";
+    fprintf(saida, "static const %s gabaritoSementes[GABARITO_QTD_BALDES] = {", tipoSemente);
+    for (int b = 0; b < qtdBaldes; b++) {
+        fprintf(saida, "%s%s%u", b ? "," : "", b % 16 == 0 ? "\n    " : " ", (unsigned)sementes[b]);
+    }
+    fprintf(saida, "\n};\n\n");
+
+    // Mesmo código da hashGabarito deste gerador
+    fprintf(saida,
+            "static inline uint64_t hashGabarito(const char* chave, uint64_t semente) {\n"
+            "    uint64_t hash = 14695981039346656037ULL ^ (semente * 0x9E3779B97F4A7C15ULL);\n"
+            "    for (const unsigned char* c = (const unsigned char*)chave; *c != '\\0'; c++) {\n"
+            "        hash ^= *c;\n"
+            "        hash *= 1099511628211ULL;\n"
+            "    }\n"
+            "    hash ^= hash >> 32;\n"
+            "    hash *= 0xD6E8FEB86659FD93ULL;\n"
+            "    hash ^= hash >> 32;\n"
+            "    return hash;\n"
+            "}\n\n");
+    fprintf(saida,
+            "// Posição da pista em gabaritoPistas, ou -1 se ela não está no gabarito\n"
+            "static inline int buscarGabarito(const char* pista) {\n"
+            "    uint32_t semente = gabaritoSementes[hashGabarito(pista, 0) %% GABARITO_QTD_BALDES];\n"
+            "    int pos = (int)(hashGabarito(pista, semente) %% GABARITO_QTD_PISTAS);\n"
+            "    return strcmp(gabaritoPistas[pos].pista, pista) == 0 ? pos : -1;\n"
+            "}\n\n");
+    fprintf(saida, "#endif\n");
+
+    free(naPosicao);
+    bool ok = !ferror(saida);
+    if (fclose(saida) != 0) ok = false;
+    return ok;
+}
+
+// ============================================================================
+// FUNÇÃO PRINCIPAL
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    const char* entrada = argc > 1 ? argv[1] : "gabarito_pistas.txt";
+    const char* saida = argc > 2 ? argv[2] : "Gabarito_Pistas.h";
+
+    static Associacao associacoes[MAX_ASSOCIACOES];
+    char suspeitos[MAX_SUSPEITOS][50];
+    int qtdSuspeitos;
+    int qtd = lerGabarito(entrada, associacoes, suspeitos, &qtdSuspeitos);
+    if (qtd < 0) return 1;
+    if (qtd == 0) {
+        printf("[ERRO] %s não tem nenhuma associação.\n", entrada);
+        return 1;
+    }
+
+    uint32_t* sementes = NULL;
+    int* posicoes = (int*)malloc(qtd * sizeof(int));
+    int qtdBaldes = (qtd + 1) / 2;
+    bool construido = false;
+    // Se algum balde não achar semente (raro), tenta de novo com mais baldes
+    while (!construido && qtdBaldes <= qtd) {
+        sementes = (uint32_t*)realloc(sementes, qtdBaldes * sizeof(uint32_t));
+        if (sementes == NULL || posicoes == NULL) {
+            printf("Erro crítico: Falha na alocação de memória.\n");
+            exit(1);
+        }
+        construido = construirHashPerfeito(associacoes, qtd, qtdBaldes, sementes, posicoes);
+        if (!construido) qtdBaldes += (qtdBaldes + 3) / 4;
+    }
+    if (!construido) {
+        printf("[ERRO] Não foi possível construir o hash perfeito.\n");
+        return 1;
+    }
+
+    // Conferência: cada pista cai na própria posição e as posições são distintas
+    for (int i = 0; i < qtd; i++) {
+        Associacao* a = &associacoes[i];
+        uint32_t semente = sementes[hashGabarito(a->pista, 0) % qtdBaldes];
+        if ((int)(hashGabarito(a->pista, semente) % qtd) != posicoes[i]) {
+            printf("[ERRO] Conferência falhou para \"%s\".\n", a->pista);
+            return 1;
+        }
+    }
+
+    if (!gravarCabecalho(saida, entrada, associacoes, qtd, posicoes, sementes, qtdBaldes,
+                         suspeitos, qtdSuspeitos)) {
+        printf("[ERRO] Falha ao gravar %s.\n", saida);
+        return 1;
+    }
+    printf("%s: %d pistas, %d suspeitos, %d baldes\n", saida, qtd, qtdSuspeitos, qtdBaldes);
+
+    free(sementes);
+    free(posicoes);
+    return 0;
+}
@@ -0,0 +1,528 @@
+/*
+ * Objetivo: Tabela pista -> suspeito com endereçamento aberto no estilo
+ *           SwissTable, como alternativa ao encadeamento (HashNode) do
+ *           Detective_Quest_Mestre.c, e comparação entre as duas.
+ *
+ * Estrutura:
+ * 1. Entradas (pista + suspeito) guardadas direto no vetor de posições:
+ *    nenhum malloc por pista e nenhum ponteiro "proximo" para seguir.
+ * 2. Um byte de controle por posição: VAZIO, APAGADO ou, se ocupada, os
+ *    7 bits altos do hash (a "etiqueta").
+ * 3. As posições formam grupos de 16. Uma busca compara a etiqueta com os
+ *    16 bytes de controle do grupo de uma vez (SSE2) e só faz strcmp nas
+ *    posições que batem. Um grupo com alguma posição VAZIA encerra a busca.
+ * 4. Remoção: a posição vira VAZIO se o grupo já tem uma posição vazia
+ *    (nenhuma busca passa dele); senão vira APAGADO, para não cortar a
+ *    sequência de sondagem de outras pistas. Os APAGADOS somem na próxima
+ *    reconstrução da tabela.
+ *
+ * Sem SSE2 (outras arquiteturas), os mesmos grupos são comparados byte a byte.
+ *
+ * Compilação: gcc -O2 Hash_Swiss.c -o Hash_Swiss
+ * Uso: ./Hash_Swiss [max_pistas]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define USAR_SSE2
+#endif
+
+#ifdef _WIN32
+#include <malloc.h>
+#define aligned_alloc(alinhamento, tamanho) _aligned_malloc(tamanho, alinhamento) // ucrt não tem aligned_alloc
+#define liberarAlinhado _aligned_free
+#else
+#define liberarAlinhado free
+#endif
+
+#define TAM_GRUPO 16
+#define VAZIO ((int8_t)-128)   // 0x80
+#define APAGADO ((int8_t)-2)   // 0xFE; posições ocupadas têm o bit alto desligado
+
+// ============================================================================
+// ESTRUTURAS
+// ============================================================================
+
+// Entrada guardada dentro da tabela (mesmos campos do HashNode)
+typedef struct {
+    char pista[100];
+    char suspeito[50];
+} EntradaSwiss;
+
+typedef struct {
+    int8_t* controle;         // Um byte por posição (alinhado em 16)
+    EntradaSwiss* entradas;
+    int capacidade;           // Múltiplo de TAM_GRUPO e potência de 2
+    int qtd;
+    int apagados;             // Posições APAGADO (contam para a carga)
+} TabelaSwiss;
+
+// Tabela encadeada do Detective_Quest_Mestre.c, para comparação
+typedef struct HashNode {
+    char pista[100];
+    char suspeito[50];
+    uint64_t hash;            // Hash completo da pista (não é recalculado ao crescer)
+    struct HashNode* proximo; // Tratamento de colisão por encadeamento
+} HashNode;
+
+typedef struct {
+    HashNode** baldes;
+    int capacidade;           // Sempre potência de 2 (índice = hash & (capacidade - 1))
+    int qtd;
+} TabelaHash;
+
+#define CAPACIDADE_INICIAL_HASH 32
+#define CARGA_MAXIMA_HASH 0.75 // Acima disso a tabela dobra de tamanho
+
+// ============================================================================
+// HASH E GRUPOS DE CONTROLE
+// ============================================================================
+
+// FNV-1a de 64 bits (a mesma funcaoHash do Detective_Quest_Mestre.c)
+uint64_t funcaoHash(const char* chave) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const unsigned char* c = (const unsigned char*)chave; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Etiqueta: 7 bits altos do hash. O grupo inicial usa os bits baixos.
+int8_t etiquetaHash(uint64_t hash) {
+    return (int8_t)(hash >> 57);
+}
+
+// Máscara de 16 bits: bit i ligado se controle[i] == etiqueta
+unsigned int gruposIguais(const int8_t* grupo, int8_t etiqueta) {
+#ifdef USAR_SSE2
+    __m128i bytes = _mm_load_si128((const __m128i*)grupo);
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(etiqueta)));
+#else
+    unsigned int mascara = 0;
+    for (int i = 0; i < TAM_GRUPO; i++) mascara |= (unsigned int)(grupo[i] == etiqueta) << i;
+    return mascara;
+#endif
+}
+
+// Máscara das posições livres (VAZIO ou APAGADO: os dois têm o bit alto ligado)
+unsigned int gruposLivres(const int8_t* grupo) {
+#ifdef USAR_SSE2
+    return (unsigned int)_mm_movemask_epi8(_mm_load_si128((const __m128i*)grupo));
+#else
+    unsigned int mascara = 0;
+    for (int i = 0; i < TAM_GRUPO; i++) mascara |= (unsigned int)(grupo[i] < 0) << i;
+    return mascara;
+#endif
+}
+
+// Auxiliar: índice do bit ligado mais baixo (x != 0)
+int indiceMenorBit(unsigned int x) {
+#if defined(__GNUC__)
+    return __builtin_ctz(x);
+#else
+    int i = 0;
+    while (!(x & 1)) { x >>= 1; i++; }
+    return i;
+#endif
+}
+
+// ============================================================================
+// TABELA SWISS
+// ============================================================================
+
+// Auxiliar: aloca controle (alinhado em 16 para o _mm_load_si128) e entradas
+void alocarSwiss(TabelaSwiss* tabela, int capacidade) {
+    tabela->capacidade = capacidade;
+    tabela->qtd = 0;
+    tabela->apagados = 0;
+    // Tamanho múltiplo de 16, como o aligned_alloc exige
+    tabela->controle = (int8_t*)aligned_alloc(TAM_GRUPO, capacidade);
+    tabela->entradas = (EntradaSwiss*)malloc((size_t)capacidade * sizeof(EntradaSwiss));
+    if (tabela->controle == NULL || tabela->entradas == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    memset(tabela->controle, VAZIO, capacidade);
+}
+
+void iniciarSwiss(TabelaSwiss* tabela) {
+    alocarSwiss(tabela, TAM_GRUPO);
+}
+
+/*
+ * Função: buscarPosicaoSwiss
+ * Sondagem por grupos: o grupo inicial vem do hash e os seguintes seguem
+ * saltos 1, 2, 3... (sondagem triangular, passa por todos os grupos quando
+ * a quantidade é potência de 2). Retorna a posição da pista ou -1.
+ */
+int buscarPosicaoSwiss(TabelaSwiss* tabela, const char* pista, uint64_t hash) {
+    int8_t etiqueta = etiquetaHash(hash);
+    int mascaraGrupos = tabela->capacidade / TAM_GRUPO - 1;
+    int grupo = (int)(hash & mascaraGrupos);
+    for (int salto = 1; salto <= mascaraGrupos + 1; salto++) {
+        const int8_t* controle = tabela->controle + grupo * TAM_GRUPO;
+        unsigned int candidatos = gruposIguais(controle, etiqueta);
+        while (candidatos) {
+            int pos = grupo * TAM_GRUPO + indiceMenorBit(candidatos);
+            if (strcmp(tabela->entradas[pos].pista, pista) == 0) return pos;
+            candidatos &= candidatos - 1;
+        }
+        if (gruposIguais(controle, VAZIO)) return -1; // Nenhuma pista foi colocada depois deste grupo
+        grupo = (grupo + salto) & mascaraGrupos;
+    }
+    return -1;
+}
+
+// Auxiliar: primeira posição livre (VAZIO ou APAGADO) na sequência de sondagem
+int posicaoLivreSwiss(TabelaSwiss* tabela, uint64_t hash) {
+    int mascaraGrupos = tabela->capacidade / TAM_GRUPO - 1;
+    int grupo = (int)(hash & mascaraGrupos);
+    for (int salto = 1;; salto++) {
+        unsigned int livres = gruposLivres(tabela->controle + grupo * TAM_GRUPO);
+        if (livres) return grupo * TAM_GRUPO + indiceMenorBit(livres);
+        grupo = (grupo + salto) & mascaraGrupos;
+    }
+}
+
+/*
+ * Função: reconstruirSwiss
+ * Recoloca todas as entradas em uma tabela nova (descartando os APAGADOS).
+ * A capacidade dobra se a carga real passar de 7/16 (metade do limite).
+ */
+void reconstruirSwiss(TabelaSwiss* tabela) {
+    TabelaSwiss antiga = *tabela;
+    int capacidade = antiga.capacidade;
+    if ((antiga.qtd + 1) * 16 > capacidade * 7) capacidade *= 2;
+    alocarSwiss(tabela, capacidade);
+    for (int i = 0; i < antiga.capacidade; i++) {
+        if (antiga.controle[i] >= 0) {
+            uint64_t hash = funcaoHash(antiga.entradas[i].pista);
+            int pos = posicaoLivreSwiss(tabela, hash);
+            tabela->controle[pos] = etiquetaHash(hash);
+            tabela->entradas[pos] = antiga.entradas[i];
+            tabela->qtd++;
+        }
+    }
+    liberarAlinhado(antiga.controle);
+    free(antiga.entradas);
+}
+
+/*
+ * Função: inserirSwiss
+ * Equivalente ao inserirNaHash: se a pista existe, troca o suspeito.
+ * A carga (ocupadas + apagadas) fica abaixo de 7/8.
+ */
+void inserirSwiss(TabelaSwiss* tabela, const char* pista, const char* suspeito) {
+    uint64_t hash = funcaoHash(pista);
+    int pos = buscarPosicaoSwiss(tabela, pista, hash);
+    if (pos >= 0) {
+        strcpy(tabela->entradas[pos].suspeito, suspeito);
+        return;
+    }
+    if ((tabela->qtd + tabela->apagados + 1) * 8 > tabela->capacidade * 7) reconstruirSwiss(tabela);
+
+    pos = posicaoLivreSwiss(tabela, hash);
+    if (tabela->controle[pos] == APAGADO) tabela->apagados--;
+    tabela->controle[pos] = etiquetaHash(hash);
+    strcpy(tabela->entradas[pos].pista, pista);
+    strcpy(tabela->entradas[pos].suspeito, suspeito);
+    tabela->qtd++;
+}
+
+// Equivalente ao encontrarSuspeito
+char* encontrarSuspeitoSwiss(TabelaSwiss* tabela, const char* pista) {
+    int pos = buscarPosicaoSwiss(tabela, pista, funcaoHash(pista));
+    return pos >= 0 ? tabela->entradas[pos].suspeito : NULL;
+}
+
+/*
+ * Função: removerSwiss
+ * Retorna true se a pista existia. Ver o item 4 do cabeçalho.
+ */
+bool removerSwiss(TabelaSwiss* tabela, const char* pista) {
+    int pos = buscarPosicaoSwiss(tabela, pista, funcaoHash(pista));
+    if (pos < 0) return false;
+    const int8_t* grupo = tabela->controle + (pos / TAM_GRUPO) * TAM_GRUPO;
+    if (gruposIguais(grupo, VAZIO)) {
+        tabela->controle[pos] = VAZIO;
+    } else {
+        tabela->controle[pos] = APAGADO;
+        tabela->apagados++;
+    }
+    tabela->qtd--;
+    return true;
+}
+
+void liberarSwiss(TabelaSwiss* tabela) {
+    liberarAlinhado(tabela->controle);
+    free(tabela->entradas);
+    tabela->controle = NULL;
+    tabela->entradas = NULL;
+    tabela->capacidade = tabela->qtd = tabela->apagados = 0;
+}
+
+// ============================================================================
+// TABELA ENCADEADA (igual ao Detective_Quest_Mestre.c, com remoção)
+// ============================================================================
+
+int indiceHash(TabelaHash* tabela, uint64_t hash) {
+    return (int)((hash ^ (hash >> 32)) & (uint64_t)(tabela->capacidade - 1));
+}
+
+void iniciarHash(TabelaHash* tabela) {
+    tabela->capacidade = CAPACIDADE_INICIAL_HASH;
+    tabela->qtd = 0;
+    tabela->baldes = (HashNode**)calloc(tabela->capacidade, sizeof(HashNode*));
+    if (tabela->baldes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+}
+
+void crescerHash(TabelaHash* tabela) {
+    HashNode** antigos = tabela->baldes;
+    int capacidadeAntiga = tabela->capacidade;
+    tabela->capacidade *= 2;
+    tabela->baldes = (HashNode**)calloc(tabela->capacidade, sizeof(HashNode*));
+    if (tabela->baldes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (int i = 0; i < capacidadeAntiga; i++) {
+        HashNode* atual = antigos[i];
+        while (atual != NULL) {
+            HashNode* proximo = atual->proximo;
+            int indice = indiceHash(tabela, atual->hash);
+            atual->proximo = tabela->baldes[indice];
+            tabela->baldes[indice] = atual;
+            atual = proximo;
+        }
+    }
+    free(antigos);
+}
+
+void inserirNaHash(TabelaHash* tabela, const char* pista, const char* suspeito) {
+    uint64_t hash = funcaoHash(pista);
+    int indice = indiceHash(tabela, hash);
+    for (HashNode* atual = tabela->baldes[indice]; atual != NULL; atual = atual->proximo) {
+        if (atual->hash == hash && strcmp(atual->pista, pista) == 0) {
+            strcpy(atual->suspeito, suspeito);
+            return;
+        }
+    }
+
+    if (tabela->qtd + 1 > CARGA_MAXIMA_HASH * tabela->capacidade) {
+        crescerHash(tabela);
+        indice = indiceHash(tabela, hash);
+    }
+    HashNode* novo = (HashNode*)malloc(sizeof(HashNode));
+    if (novo == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    strcpy(novo->pista, pista);
+    strcpy(novo->suspeito, suspeito);
+    novo->hash = hash;
+    novo->proximo = tabela->baldes[indice];
+    tabela->baldes[indice] = novo;
+    tabela->qtd++;
+}
+
+char* encontrarSuspeito(TabelaHash* tabela, const char* pista) {
+    uint64_t hash = funcaoHash(pista);
+    HashNode* atual = tabela->baldes[indiceHash(tabela, hash)];
+    while (atual != NULL) {
+        if (atual->hash == hash && strcmp(atual->pista, pista) == 0) return atual->suspeito;
+        atual = atual->proximo;
+    }
+    return NULL;
+}
+
+bool removerDaHash(TabelaHash* tabela, const char* pista) {
+    uint64_t hash = funcaoHash(pista);
+    HashNode** ligacao = &tabela->baldes[indiceHash(tabela, hash)];
+    while (*ligacao != NULL) {
+        HashNode* atual = *ligacao;
+        if (atual->hash == hash && strcmp(atual->pista, pista) == 0) {
+            *ligacao = atual->proximo;
+            free(atual);
+            tabela->qtd--;
+            return true;
+        }
+        ligacao = &atual->proximo;
+    }
+    return false;
+}
+
+void liberarHash(TabelaHash* tabela) {
+    for (int i = 0; i < tabela->capacidade; i++) {
+        HashNode* atual = tabela->baldes[i];
+        while (atual != NULL) {
+            HashNode* temp = atual;
+            atual = atual->proximo;
+            free(temp);
+        }
+    }
+    free(tabela->baldes);
+    tabela->baldes = NULL;
+    tabela->capacidade = 0;
+    tabela->qtd = 0;
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+#define TAM_CHAVE 40
+
+// Auxiliar: número aleatório de 30 bits (RAND_MAX pode ser apenas 32767)
+int aleatorio() {
+    return ((rand() & 0x7FFF) << 15) | (rand() & 0x7FFF);
+}
+
+// Auxiliar: nanossegundos por operação desde 'inicio'
+double nsPorOperacao(clock_t inicio, long operacoes) {
+    return ((double)(clock() - inicio)) / CLOCKS_PER_SEC * 1e9 / operacoes;
+}
+
+/*
+ * Função: medir
+ * Para as duas tabelas: insere 'qtd' pistas, busca pistas existentes e
+ * ausentes, remove metade e busca de novo (com os APAGADOS no caminho).
+ * Os resultados das buscas precisam ser iguais nas duas.
+ */
+void medir(char (*chaves)[TAM_CHAVE], char (*ausentes)[TAM_CHAVE], long qtd) {
+    const char* suspeitos[] = {"Jardineiro", "Mordomo", "Governanta"};
+    long qtdBuscas = 2000000;
+    long* sorteio = (long*)malloc(qtdBuscas * sizeof(long));
+    if (sorteio == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (long i = 0; i < qtdBuscas; i++) sorteio[i] = aleatorio() % qtd;
+
+    double ns[2][4];
+    long resultados[2] = {0, 0};
+    double memoria[2];
+    for (int versao = 0; versao < 2; versao++) {
+        TabelaHash encadeada;
+        TabelaSwiss swiss;
+        if (versao == 0) iniciarHash(&encadeada);
+        else iniciarSwiss(&swiss);
+
+        clock_t inicio = clock();
+        for (long i = 0; i < qtd; i++) {
+            if (versao == 0) inserirNaHash(&encadeada, chaves[i], suspeitos[i % 3]);
+            else inserirSwiss(&swiss, chaves[i], suspeitos[i % 3]);
+        }
+        ns[versao][0] = nsPorOperacao(inicio, qtd);
+        memoria[versao] = versao == 0
+            ? encadeada.capacidade * sizeof(HashNode*) + qtd * (double)sizeof(HashNode)
+            : swiss.capacidade * (1.0 + sizeof(EntradaSwiss));
+
+        // Buscas: existentes, ausentes e, depois de remover as pares, mistas
+        for (int fase = 1; fase <= 3; fase++) {
+            if (fase == 3) {
+                for (long i = 0; i < qtd; i += 2) {
+                    if (versao == 0) removerDaHash(&encadeada, chaves[i]);
+                    else removerSwiss(&swiss, chaves[i]);
+                }
+            }
+            long achados = 0;
+            inicio = clock();
+            for (long i = 0; i < qtdBuscas; i++) {
+                const char* pista = fase == 2 ? ausentes[sorteio[i]] : chaves[sorteio[i]];
+                char* suspeito = versao == 0 ? encontrarSuspeito(&encadeada, pista)
+                                             : encontrarSuspeitoSwiss(&swiss, pista);
+                if (suspeito != NULL) achados += suspeito[0];
+            }
+            ns[versao][fase] = nsPorOperacao(inicio, qtdBuscas);
+            resultados[versao] = resultados[versao] * 31 + achados;
+        }
+
+        if (versao == 0) liberarHash(&encadeada);
+        else liberarSwiss(&swiss);
+    }
+
+    printf("%9ld | %8.0f %8.0f %8.0f %8.0f %7.1f | %8.0f %8.0f %8.0f %8.0f %7.1f | %s\n", qtd,
+           ns[0][0], ns[0][1], ns[0][2], ns[0][3], memoria[0] / (1024.0 * 1024.0),
+           ns[1][0], ns[1][1], ns[1][2], ns[1][3], memoria[1] / (1024.0 * 1024.0),
+           resultados[0] == resultados[1] ? "ok" : "ERRO");
+    free(sorteio);
+}
+
+// ============================================================================
+// FUNÇÃO PRINCIPAL
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    long maximo = 1000000;
+    if (argc > 1 && atol(argv[1]) >= 1000) maximo = atol(argv[1]);
+
+    printf("==========================================================================\n");
+    printf("      TABELA PISTA -> SUSPEITO: ENCADEAMENTO vs SWISSTABLE (%s)\n",
+#ifdef USAR_SSE2
+           "SSE2"
+#else
+           "sem SIMD"
+#endif
+    );
+    printf("==========================================================================\n");
+
+    // 1. O gabarito do jogo
+    TabelaSwiss tabela;
+    iniciarSwiss(&tabela);
+    inserirSwiss(&tabela, "Pegadas de lama no chão", "Jardineiro");
+    inserirSwiss(&tabela, "Terra revirada recente", "Jardineiro");
+    inserirSwiss(&tabela, "Relógio parado às 10h", "Mordomo");
+    inserirSwiss(&tabela, "Taça de vinho quebrada", "Mordomo");
+    inserirSwiss(&tabela, "Livro de venenos aberto", "Governanta");
+    inserirSwiss(&tabela, "Chave enferrujada antiga", "Governanta");
+    const char* consultas[] = {"Taça de vinho quebrada", "Chave enferrujada antiga", "Vela apagada"};
+    for (int i = 0; i < 3; i++) {
+        char* suspeito = encontrarSuspeitoSwiss(&tabela, consultas[i]);
+        printf("%-26s -> %s\n", consultas[i], suspeito ? suspeito : "(pista desconhecida)");
+    }
+    removerSwiss(&tabela, "Taça de vinho quebrada");
+    printf("Após remover a taça: %s | %d pistas em %d posições\n\n",
+           encontrarSuspeitoSwiss(&tabela, "Taça de vinho quebrada") ? "ainda encontrada (ERRO!)" : "não encontrada",
+           tabela.qtd, tabela.capacidade);
+    liberarSwiss(&tabela);
+
+    // 2. Comparação
+    const char* objetos[] = {"Pegadas de lama", "Relogio parado", "Livro de venenos", "Taca quebrada",
+                             "Chave enferrujada", "Carta rasgada", "Luva manchada", "Vela apagada"};
+    char (*chaves)[TAM_CHAVE] = (char (*)[TAM_CHAVE])malloc(maximo * TAM_CHAVE);
+    char (*ausentes)[TAM_CHAVE] = (char (*)[TAM_CHAVE])malloc(maximo * TAM_CHAVE);
+    if (chaves == NULL || ausentes == NULL) {
+        printf("Erro crítico: Falha na alocação de memória.\n");
+        exit(1);
+    }
+    for (long i = 0; i < maximo; i++) {
+        sprintf(chaves[i], "%s, registro %ld", objetos[i % 8], i);
+        sprintf(ausentes[i], "%s, arquivo %ld", objetos[i % 8], i);
+    }
+    srand(42);
+
+    printf("%9s | %-43s | %-43s |\n", "", "Encadeada (ns por operacao, MB)", "SwissTable (ns por operacao, MB)");
+    printf("%9s | %8s %8s %8s %8s %7s | %8s %8s %8s %8s %7s |\n", "Pistas",
+           "Insere", "Achada", "Ausente", "Pos-rem", "MB", "Insere", "Achada", "Ausente", "Pos-rem", "MB");
+    for (long qtd = 1000; qtd <= maximo; qtd *= 10) {
+        medir(chaves, ausentes, qtd);
+        fflush(stdout);
+    }
+    printf("\nPos-rem = buscas depois de remover metade das pistas\n");
+
+    free(chaves);
+    free(ausentes);
+    printf("\nFim do programa.\n");
+    return 0;
+}